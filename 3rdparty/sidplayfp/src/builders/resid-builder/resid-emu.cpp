@@ -98,6 +98,11 @@ void ReSID::clock()
     m_bufferpos += m_sid.clock(cycles, m_muted ? nullptr : (short *) m_buffer + m_bufferpos, OUTPUTBUFFERSIZE - m_bufferpos, 1);
 }
 
+void ReSID::fastSkip(bool enable)
+{
+    m_sid.enable_fast_skip(enable);
+}
+
 void ReSID::filter(bool enable)
 {
     m_sid.enable_filter(enable);
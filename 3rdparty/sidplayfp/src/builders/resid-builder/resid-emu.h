@@ -69,6 +69,8 @@ public:
 
     void voice(unsigned int num, bool mute) override;
 
+    void fastSkip(bool enable) override;
+
     void model(SidConfig::sid_model_t model, bool digiboost) override;
 
     // Specific to resid
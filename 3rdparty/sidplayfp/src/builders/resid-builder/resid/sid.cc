@@ -85,6 +85,7 @@ SID::SID()
   scaleFactor = 3;
 
   raw_debug_output = false;
+  fast_skip = false;
 }
 
 
@@ -534,6 +535,15 @@ void SID::enable_raw_debug_output(bool enable)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Fast skip mode. Filters are not clocked while skipping without output,
+// registers and oscillators state are kept valid.
+// ----------------------------------------------------------------------------
+void SID::enable_fast_skip(bool enable)
+{
+  fast_skip = enable;
+}
+
 // ----------------------------------------------------------------------------
 // I0() computes the 0th order modified Bessel function of the first kind.
 // This function is originally from resample-1.5/filterkit.c by J. O. Smith.
@@ -820,6 +830,11 @@ void SID::clock(cycle_count delta_t)
     voice[i].wave.set_waveform_output(delta_t);
   }
 
+  // Filters state affects only the sound output.
+  if (unlikely(fast_skip)) {
+    return;
+  }
+
   // Clock filter.
   filter.clock(delta_t, voice[0].output(), voice[1].output(), voice[2].output());
 
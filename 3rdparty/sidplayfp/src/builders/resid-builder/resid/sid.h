@@ -51,6 +51,7 @@ public:
   double filter_scale = 0.97);
   void adjust_sampling_frequency(double sample_freq);
   void enable_raw_debug_output(bool enable);
+  void enable_fast_skip(bool enable);
 
   void clock();
   void clock(cycle_count delta_t);
@@ -173,6 +174,9 @@ public:
   short* fir;
 
   bool raw_debug_output; // FIXME: should be private?
+
+  // Skip filters emulation in delta clocking without output.
+  bool fast_skip;
 };
 
 
@@ -149,7 +149,10 @@ void Mixer::begin(short *buffer, uint_least32_t count)
     m_sampleIndex  = 0;
     m_sampleCount  = count;
     m_sampleBuffer = buffer;
-    std::for_each(m_chips.begin(), m_chips.end(), [muted = !buffer](sidemu* s) {s->mute(muted);});
+    std::for_each(m_chips.begin(), m_chips.end(), [muted = !buffer, fast = !buffer && m_fastSkip](sidemu* s) {
+        s->mute(muted);
+        s->fastSkip(fast);
+    });
 }
 
 void Mixer::updateParams()
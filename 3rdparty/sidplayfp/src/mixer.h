@@ -110,6 +110,8 @@ private:
 
     bool m_stereo;
 
+    bool m_fastSkip;
+
     randomLCG<VOLUME_MAX> m_rand;
 
 private:
@@ -183,6 +185,7 @@ public:
         m_sampleCount(0),
         m_sampleRate(0),
         m_stereo(false),
+        m_fastSkip(false),
         m_rand(257254)
     {
         m_mix.push_back(&Mixer::mono<1>);
@@ -241,6 +244,11 @@ public:
      */
     bool setFastForward(int ff);
 
+    /**
+     * Skip chips sound generation stages when mixing without buffer.
+     */
+    void setFastSkip(bool enable) { m_fastSkip = enable; }
+
     /**
      * Set mixing volumes, from 0 to #VOLUME_MAX.
      *
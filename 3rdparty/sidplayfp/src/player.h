@@ -147,6 +147,8 @@ public:
 
     bool fastForward(unsigned int percent);
 
+    void fastSkip(bool enable) { m_mixer.setFastSkip(enable); }
+
     bool load(SidTune *tune);
 
     uint_least32_t play(short *buffer, uint_least32_t samples);
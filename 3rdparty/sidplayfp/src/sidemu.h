@@ -115,6 +115,12 @@ public:
 
     virtual void mute(bool muted) { m_muted = muted; }
 
+    /**
+     * Enable/disable sound generation stages emulation while muted.
+     * Used to fast-forward when only chip registers state matters.
+     */
+    virtual void fastSkip(bool) {}
+
     /**
      * Set SID model.
      */
@@ -91,6 +91,11 @@ bool  sidplayfp::fastForward(unsigned int percent)
     return sidplayer.fastForward(percent);
 }
 
+void sidplayfp::fastSkip(bool enable)
+{
+    sidplayer.fastSkip(enable);
+}
+
 void sidplayfp::mute(unsigned int sidNum, unsigned int voice, bool enable)
 {
     sidplayer.mute(sidNum, voice, enable);
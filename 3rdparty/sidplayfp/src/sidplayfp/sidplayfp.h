@@ -89,6 +89,14 @@ public:
      */
     bool fastForward(unsigned int percent);
 
+    /**
+     * Skip sound chips filters emulation while playing without buffer.
+     * Chips registers are kept in sync, filters state is restored after short period of normal playback.
+     *
+     * @param enable
+     */
+    void fastSkip(bool enable);
+
     /**
      * Load a tune.
      * Check #error for detailed message if something goes wrong.
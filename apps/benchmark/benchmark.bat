@@ -1,3 +1,3 @@
 @echo off
 reg query HKLM\HARDWARE\DESCRIPTION\System\CentralProcessor\0 > result.log
-benchmark.exe >> result.log
+benchmark.exe %* >> result.log
@@ -0,0 +1,135 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Memory allocations counting implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "allocations.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#  include <malloc.h>
+#endif
+
+namespace
+{
+  std::atomic<uint64_t> Allocations;
+}  // namespace
+
+namespace
+{
+  void* Allocate(std::size_t size)
+  {
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* ptr = std::malloc(size ? size : 1))
+    {
+      return ptr;
+    }
+    throw std::bad_alloc();
+  }
+
+  void* Allocate(std::size_t size, std::align_val_t align)
+  {
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto alignment = std::max(static_cast<std::size_t>(align), sizeof(void*));
+#ifdef _WIN32
+    if (auto* ptr = ::_aligned_malloc(size ? size : 1, alignment))
+    {
+      return ptr;
+    }
+#else
+    void* ptr = nullptr;
+    if (0 == ::posix_memalign(&ptr, alignment, size ? size : 1))
+    {
+      return ptr;
+    }
+#endif
+    throw std::bad_alloc();
+  }
+
+  // aligned memory may be allocated by different function
+  void FreeAligned(void* ptr)
+  {
+#ifdef _WIN32
+    ::_aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+  }
+}  // namespace
+
+// nothrow forms are routed to the throwing ones by standard library
+void* operator new(std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+  return Allocate(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+  return Allocate(size, align);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*align*/) noexcept
+{
+  FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*align*/) noexcept
+{
+  FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/, std::align_val_t /*align*/) noexcept
+{
+  FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/, std::align_val_t /*align*/) noexcept
+{
+  FreeAligned(ptr);
+}
+
+namespace Benchmark::Allocations
+{
+  uint64_t Count()
+  {
+    return ::Allocations.load(std::memory_order_relaxed);
+  }
+}  // namespace Benchmark::Allocations
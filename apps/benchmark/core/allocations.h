@@ -0,0 +1,20 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Memory allocations counting interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "types.h"
+
+namespace Benchmark::Allocations
+{
+  //! @return Total count of global operator new calls since process start
+  //! @note Using this function replaces global allocation operators for whole application
+  uint64_t Count();
+}  // namespace Benchmark::Allocations
@@ -66,6 +66,11 @@ namespace
       return Devices::AYM::LAYOUT_ABC;
     }
 
+    uint_t MuteMask() const override
+    {
+      return 0;
+    }
+
   private:
     const uint64_t Clock;
     const uint_t Sound;
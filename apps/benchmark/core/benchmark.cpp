@@ -11,9 +11,14 @@
 #include "benchmark.h"
 
 #include "ay.h"
+#include "dac.h"
 #include "mixer.h"
+#include "queue.h"
+#include "saa.h"
 #include "z80.h"
 
+#include "async/ring_queue.h"
+#include "async/sized_queue.h"
 #include "binary/dump.h"
 #include "strings/format.h"
 
@@ -74,6 +79,90 @@ namespace Benchmark
     }
   }  // namespace AY
 
+  namespace DAC
+  {
+    class PerformanceTest : public Benchmark::PerformanceTest
+    {
+    public:
+      explicit PerformanceTest(bool interpolate)
+        : Interpolate(interpolate)
+      {}
+
+      std::string Category() const override
+      {
+        return "DAC emulation";
+      }
+
+      std::string Name() const override
+      {
+        return Interpolate ? "4 channels with interpolation" : "4 channels";
+      }
+
+      double Execute() const override
+      {
+        const Devices::DAC::Chip::Ptr dev = CreateDevice(SOUND_FREQ, Interpolate);
+        return Test(*dev, TEST_DURATION, FRAME_DURATION);
+      }
+
+    private:
+      const bool Interpolate;
+    };
+
+    void ForAllTests(TestsVisitor& visitor)
+    {
+      visitor.OnPerformanceTest(PerformanceTest(false));
+      visitor.OnPerformanceTest(PerformanceTest(true));
+    }
+  }  // namespace DAC
+
+  namespace SAA
+  {
+    class PerformanceTest : public Benchmark::PerformanceTest
+    {
+    public:
+      explicit PerformanceTest(Devices::SAA::InterpolationType interpolate)
+        : Interpolate(interpolate)
+      {}
+
+      std::string Category() const override
+      {
+        return "SAA chip emulation";
+      }
+
+      std::string Name() const override
+      {
+        switch (Interpolate)
+        {
+        case Devices::SAA::INTERPOLATION_NONE:
+          return "No interpolation";
+        case Devices::SAA::INTERPOLATION_LQ:
+          return "LQ interpolation";
+        case Devices::SAA::INTERPOLATION_HQ:
+          return "HQ interpolation";
+        default:
+          Require(false);
+          return "Invalid interpolation";
+        }
+      }
+
+      double Execute() const override
+      {
+        const Devices::SAA::Chip::Ptr dev = CreateDevice(8000000, SOUND_FREQ, Interpolate);
+        return Test(*dev, TEST_DURATION, FRAME_DURATION);
+      }
+
+    private:
+      const Devices::SAA::InterpolationType Interpolate;
+    };
+
+    void ForAllTests(TestsVisitor& visitor)
+    {
+      visitor.OnPerformanceTest(PerformanceTest(Devices::SAA::INTERPOLATION_NONE));
+      visitor.OnPerformanceTest(PerformanceTest(Devices::SAA::INTERPOLATION_LQ));
+      visitor.OnPerformanceTest(PerformanceTest(Devices::SAA::INTERPOLATION_HQ));
+    }
+  }  // namespace SAA
+
   namespace Z80
   {
     class MemoryPerformanceTest : public Benchmark::PerformanceTest
@@ -204,10 +293,60 @@ namespace Benchmark
     }
   }  // namespace Mixer
 
+  namespace Queue
+  {
+    const uint_t QUEUE_SIZE = 16;
+    const uint_t ITEMS_COUNT = 1000000;
+
+    class PerformanceTest : public Benchmark::PerformanceTest
+    {
+    public:
+      PerformanceTest(bool lockFree, uint_t threads)
+        : LockFree(lockFree)
+        , Threads(threads)
+      {}
+
+      std::string Category() const override
+      {
+        return LockFree ? "Lock-free queue" : "Locking queue";
+      }
+
+      std::string Name() const override
+      {
+        return Strings::Format("{0} producers, {0} consumers", Threads);
+      }
+
+      double Execute() const override
+      {
+        const auto queue = LockFree ? Async::RingQueue<uint_t>::Create(QUEUE_SIZE)
+                                    : Async::SizedQueue<uint_t>::Create(QUEUE_SIZE);
+        return Test(*queue, Threads, Threads, ITEMS_COUNT);
+      }
+
+    private:
+      const bool LockFree;
+      const uint_t Threads;
+    };
+
+    void ForAllTests(TestsVisitor& visitor)
+    {
+      for (const auto lockFree : {false, true})
+      {
+        for (uint_t threads = 1; threads <= 4; threads *= 2)
+        {
+          visitor.OnPerformanceTest(PerformanceTest(lockFree, threads));
+        }
+      }
+    }
+  }  // namespace Queue
+
   void ForAllTests(TestsVisitor& visitor)
   {
     AY::ForAllTests(visitor);
+    DAC::ForAllTests(visitor);
+    SAA::ForAllTests(visitor);
     Z80::ForAllTests(visitor);
     Mixer::ForAllTests(visitor);
+    Queue::ForAllTests(visitor);
   }
 }  // namespace Benchmark
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 namespace Benchmark
 {
@@ -26,6 +27,11 @@ namespace Benchmark
     virtual std::string Name() const = 0;
     //! @return Performance index
     virtual double Execute() const = 0;
+    //! @return Additional information about last execution
+    virtual std::string Details() const
+    {
+      return {};
+    }
   };
 
   class TestsVisitor
@@ -37,4 +43,6 @@ namespace Benchmark
   };
 
   void ForAllTests(TestsVisitor& visitor);
+  //! @brief Visits playback tests for all the modules found in specified files
+  void ForAllModulesTests(const std::vector<std::string>& files, TestsVisitor& visitor);
 }  // namespace Benchmark
@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ * @brief  DAC test implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "dac.h"
+
+#include "devices/dac/sample_factories.h"
+#include "sound/matrix_mixer.h"
+#include "time/timer.h"
+
+#include "make_ptr.h"
+
+#include <array>
+
+namespace
+{
+  // ProDigiTracker-like setup
+  const uint_t CHANNELS = 4;
+  const uint_t SAMPLES_FREQ = 3500000 * 46 / 374 / 256;
+  const std::size_t SAMPLE_SIZE = 8192;
+
+  class DACParameters : public Devices::DAC::ChipParameters
+  {
+  public:
+    DACParameters(uint_t soundFreq, bool interpolate)
+      : Sound(soundFreq)
+      , Interpolation(interpolate)
+    {}
+
+    uint_t Version() const override
+    {
+      return 1;
+    }
+
+    uint_t BaseSampleFreq() const override
+    {
+      return SAMPLES_FREQ;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return Sound;
+    }
+
+    bool Interpolate() const override
+    {
+      return Interpolation;
+    }
+
+    uint_t MuteMask() const override
+    {
+      return 0;
+    }
+
+  private:
+    const uint_t Sound;
+    const bool Interpolation;
+  };
+
+  void SetSamples(Devices::DAC::Chip& dev)
+  {
+    std::array<uint8_t, SAMPLE_SIZE> content;
+    for (uint_t idx = 0; idx != CHANNELS; ++idx)
+    {
+      for (std::size_t pos = 0; pos != SAMPLE_SIZE; ++pos)
+      {
+        content[pos] = static_cast<uint8_t>(pos * (idx + 1));
+      }
+      // odd samples are looped
+      const auto loop = idx & 1 ? SAMPLE_SIZE / 2 : SAMPLE_SIZE;
+      const auto sample = Devices::DAC::CreateU8Sample(content, loop);
+      dev.SetSample(idx, *sample);
+    }
+  }
+}  // namespace
+
+namespace Benchmark::DAC
+{
+  Devices::DAC::Chip::Ptr CreateDevice(uint_t soundFreq, bool interpolate)
+  {
+    auto params = MakePtr<DACParameters>(soundFreq, interpolate);
+    auto result = Devices::DAC::CreateChip(std::move(params), Sound::FourChannelsMatrixMixer::Create());
+    SetSamples(*result);
+    return result;
+  }
+
+  double Test(Devices::DAC::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration)
+  {
+    using namespace Devices::DAC;
+    const Time::Timer timer;
+    DataChunk chunk;
+    chunk.Data.resize(CHANNELS);
+    const auto period = frameDuration.CastTo<TimeUnit>();
+    const auto frames = duration.Divide<uint_t>(frameDuration);
+    for (uint_t frame = 0; frame != frames; ++frame)
+    {
+      for (uint_t chan = 0; chan != CHANNELS; ++chan)
+      {
+        auto& data = chunk.Data[chan];
+        data.Channel = chan;
+        data.Mask = ChannelData::NOTE | ChannelData::LEVEL;
+        data.Note = (frame + chan * 7) % 48;
+        data.Level = ChannelData::LevelType(static_cast<int_t>(frame % 100), 100);
+        // restart samples periodically
+        if (frame % 16 == chan)
+        {
+          data.Mask |= ChannelData::ENABLED | ChannelData::SAMPLENUM | ChannelData::POSINSAMPLE;
+          data.Enabled = true;
+          data.SampleNum = chan;
+          data.PosInSample = 0;
+        }
+      }
+      dev.RenderData(chunk);
+      chunk.TimeStamp += period;
+      dev.RenderTill(chunk.TimeStamp);
+    }
+    const auto elapsed = timer.Elapsed<TimeUnit>();
+    return double(chunk.TimeStamp.Get()) / elapsed.Get();
+  }
+}  // namespace Benchmark::DAC
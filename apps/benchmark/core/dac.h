@@ -0,0 +1,21 @@
+/**
+ *
+ * @file
+ *
+ * @brief  DAC test interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "devices/dac.h"
+
+#include "time/duration.h"
+
+namespace Benchmark::DAC
+{
+  Devices::DAC::Chip::Ptr CreateDevice(uint_t soundFreq, bool interpolate);
+  double Test(Devices::DAC::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration);
+}  // namespace Benchmark::DAC
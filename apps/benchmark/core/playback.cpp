@@ -0,0 +1,317 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Modules playback test implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "allocations.h"
+#include "benchmark.h"
+#include "playback.h"
+
+#include "binary/container_factories.h"
+#include "core/core_parameters.h"
+#include "core/data_location.h"
+#include "core/module_detect.h"
+#include "core/plugin.h"
+#include "core/plugin_attrs.h"
+#include "core/service.h"
+#include "module/attributes.h"
+#include "module/players/pipeline.h"
+#include "parameters/container.h"
+#include "sound/sound_parameters.h"
+#include "strings/format.h"
+#include "time/timer.h"
+
+#include "error_tools.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+  Binary::Container::Ptr OpenFile(const std::string& path)
+  {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+      throw MakeFormattedError(THIS_LINE, "Failed to open file '{}'.", path);
+    }
+    auto content = std::make_unique<Binary::Dump>(std::istreambuf_iterator<char>(stream),
+                                                  std::istreambuf_iterator<char>());
+    return Binary::CreateContainer(std::move(content));
+  }
+
+  std::string GetFamily(uint_t caps)
+  {
+    using namespace ZXTune::Capabilities::Module::Device;
+    if (caps & (AY38910 | TURBOSOUND | BEEPER))
+    {
+      return "AYM";
+    }
+    else if (caps & (YM2203 | TURBOFM))
+    {
+      return "TFM";
+    }
+    else if (caps & SAA1099)
+    {
+      return "SAA";
+    }
+    else if (caps & MOS6581)
+    {
+      return "SID";
+    }
+    else if (caps & (SPC700 | RP2A0X | LR35902 | HUC6270))
+    {
+      return "GME";
+    }
+    else if (caps & DAC)
+    {
+      return "DAC";
+    }
+    else
+    {
+      return "Other";
+    }
+  }
+
+  class CollectModules : public Module::DetectCallback
+  {
+  public:
+    CollectModules(std::string path, std::vector<Benchmark::Playback::Item>& result)
+      : Path(std::move(path))
+      , Result(result)
+    {}
+
+    Parameters::Container::Ptr CreateInitialProperties(StringView /*subpath*/) const override
+    {
+      return Parameters::Container::Create();
+    }
+
+    void ProcessModule(const ZXTune::DataLocation& location, const ZXTune::Plugin& decoder,
+                       Module::Holder::Ptr holder) override
+    {
+      const auto subpath = location.GetPath()->AsString();
+      const auto type = Parameters::GetString(*holder->GetModuleProperties(), Module::ATTR_TYPE);
+      auto name = type + ' ' + Path + (subpath.empty() ? subpath : '?' + subpath);
+      Result.push_back({std::move(holder), GetFamily(decoder.Capabilities()), std::move(name)});
+    }
+
+    Log::ProgressCallback* GetProgress() const override
+    {
+      return nullptr;
+    }
+
+  private:
+    const std::string Path;
+    std::vector<Benchmark::Playback::Item>& Result;
+  };
+
+  const ZXTune::Service& GetService()
+  {
+    static const auto instance = ZXTune::Service::Create(Parameters::Container::Create());
+    return *instance;
+  }
+}  // namespace
+
+namespace Benchmark::Playback
+{
+  std::vector<Item> OpenModules(const std::string& path)
+  {
+    std::vector<Item> result;
+    const auto& service = GetService();
+    const auto subpathPos = path.find('?');
+    if (subpathPos == std::string::npos)
+    {
+      CollectModules callback(path, result);
+      service.DetectModules(OpenFile(path), callback);
+    }
+    else
+    {
+      const auto filename = path.substr(0, subpathPos);
+      CollectModules callback(filename, result);
+      service.OpenModule(OpenFile(filename), path.substr(subpathPos + 1), callback);
+    }
+    return result;
+  }
+
+  Result Test(const Module::Holder& holder, uint_t interpolation, const Time::Milliseconds& duration,
+              uint_t soundFreq)
+  {
+    using namespace Parameters::ZXTune;
+    const auto params = Parameters::Container::Create();
+    params->SetValue(Core::AYM::INTERPOLATION, interpolation);
+    params->SetValue(Core::SAA::INTERPOLATION, interpolation);
+    params->SetValue(Core::SID::INTERPOLATION, interpolation);
+    params->SetValue(Core::DAC::INTERPOLATION, std::min<uint_t>(interpolation, Core::DAC::INTERPOLATION_YES));
+    // render specified duration regardless of module's one
+    params->SetValue(Parameters::ZXTune::Sound::LOOPED, 1);
+    const auto renderer = Module::CreatePipelinedRenderer(holder, soundFreq, params);
+    const auto samples = duration.Get() * soundFreq / duration.PER_SECOND;
+    uint64_t done = 0;
+    const auto allocationsBefore = Allocations::Count();
+    const Time::Timer timer;
+    while (done < samples)
+    {
+      const auto chunk = renderer->Render();
+      if (chunk.empty())
+      {
+        break;
+      }
+      done += chunk.size();
+    }
+    const auto elapsed = timer.Elapsed<Time::Microsecond>();
+    const auto allocations = Allocations::Count() - allocationsBefore;
+    const auto rendered = double(done) / soundFreq;
+    Result res;
+    res.Speed = elapsed.Get() ? rendered * elapsed.PER_SECOND / elapsed.Get() : 0;
+    res.AllocationsPerSecond = rendered != 0 ? allocations / rendered : 0;
+    return res;
+  }
+
+  const uint_t SOUND_FREQ = 44100;
+  const Time::Milliseconds RENDER_DURATION(60000);
+
+  class PluginsCounter : public ZXTune::PluginVisitor
+  {
+  public:
+    void Visit(const ZXTune::Plugin& /*plugin*/) override
+    {
+      ++Count;
+    }
+
+    std::size_t Count = 0;
+  };
+
+  // Cold start of library: plugins registration and the first detection with all the lazy initialization involved.
+  // So it's meaningful only as the first core usage in process.
+  class StartupTest : public Benchmark::PerformanceTest
+  {
+  public:
+    explicit StartupTest(std::string path)
+      : Path(std::move(path))
+    {}
+
+    std::string Category() const override
+    {
+      return "Startup";
+    }
+
+    std::string Name() const override
+    {
+      return "Plugins registration and detection of " + Path;
+    }
+
+    //! @return Startups per second
+    double Execute() const override
+    {
+      const auto data = OpenFile(Path);
+      const Time::Timer timer;
+      PluginsCounter plugins;
+      ZXTune::EnumeratePlugins(plugins);
+      Registration = timer.Elapsed<Time::Microsecond>();
+      std::vector<Item> modules;
+      CollectModules callback(Path, modules);
+      GetService().DetectModules(data, callback);
+      const auto total = timer.Elapsed<Time::Microsecond>();
+      Detection = Time::Microseconds(total.Get() - Registration.Get());
+      Plugins = plugins.Count;
+      Modules = modules.size();
+      return total.Get() ? double(total.PER_SECOND) / total.Get() : 0;
+    }
+
+    std::string Details() const override
+    {
+      return Strings::Format("{} plugins registered for {:.1f}ms, {} modules detected for {:.1f}ms", Plugins,
+                             Registration.Get() / 1000.0, Modules, Detection.Get() / 1000.0);
+    }
+
+  private:
+    const std::string Path;
+    mutable Time::Microseconds Registration;
+    mutable Time::Microseconds Detection;
+    mutable std::size_t Plugins = 0;
+    mutable std::size_t Modules = 0;
+  };
+
+  class PerformanceTest : public Benchmark::PerformanceTest
+  {
+  public:
+    PerformanceTest(const Item& item, uint_t interpolation)
+      : Track(item)
+      , Interpolation(interpolation)
+    {}
+
+    std::string Category() const override
+    {
+      return Track.Family + " modules playback";
+    }
+
+    std::string Name() const override
+    {
+      switch (Interpolation)
+      {
+      case 0:
+        return Track.Name + ", no interpolation";
+      case 1:
+        return Track.Name + ", LQ interpolation";
+      default:
+        return Track.Name + ", HQ interpolation";
+      }
+    }
+
+    double Execute() const override
+    {
+      const auto res = Test(*Track.Holder, Interpolation, RENDER_DURATION, SOUND_FREQ);
+      AllocationsPerSecond = res.AllocationsPerSecond;
+      return res.Speed;
+    }
+
+    std::string Details() const override
+    {
+      return Strings::Format("{:.1f} allocations per second", AllocationsPerSecond);
+    }
+
+  private:
+    const Item& Track;
+    const uint_t Interpolation;
+    mutable double AllocationsPerSecond = 0;
+  };
+
+  void ForAllTests(const std::vector<std::string>& files, TestsVisitor& visitor)
+  {
+    if (files.empty())
+    {
+      return;
+    }
+    const auto& first = files.front();
+    visitor.OnPerformanceTest(StartupTest(first.substr(0, first.find('?'))));
+    std::vector<Item> modules;
+    for (const auto& file : files)
+    {
+      auto opened = OpenModules(file);
+      std::move(opened.begin(), opened.end(), std::back_inserter(modules));
+    }
+    std::stable_sort(modules.begin(), modules.end(),
+                     [](const Item& lh, const Item& rh) { return lh.Family < rh.Family; });
+    for (const auto& mod : modules)
+    {
+      for (uint_t interpolation = 0; interpolation <= 2; ++interpolation)
+      {
+        visitor.OnPerformanceTest(PerformanceTest(mod, interpolation));
+      }
+    }
+  }
+}  // namespace Benchmark::Playback
+
+namespace Benchmark
+{
+  void ForAllModulesTests(const std::vector<std::string>& files, TestsVisitor& visitor)
+  {
+    Playback::ForAllTests(files, visitor);
+  }
+}  // namespace Benchmark
@@ -0,0 +1,43 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Modules playback test interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "module/holder.h"
+
+#include "time/duration.h"
+
+#include <string>
+#include <vector>
+
+namespace Benchmark::Playback
+{
+  struct Item
+  {
+    Module::Holder::Ptr Holder;
+    //! Emulated devices family (AYM, SAA etc)
+    std::string Family;
+    std::string Name;
+  };
+
+  //! @param path Local file path with optional ?subpath suffix
+  //! @return All the modules found
+  std::vector<Item> OpenModules(const std::string& path);
+
+  struct Result
+  {
+    //! Ratio of rendered duration to spent time
+    double Speed = 0;
+    double AllocationsPerSecond = 0;
+  };
+
+  Result Test(const Module::Holder& holder, uint_t interpolation, const Time::Milliseconds& duration,
+              uint_t soundFreq);
+}  // namespace Benchmark::Playback
@@ -0,0 +1,55 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Async queues test implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "queue.h"
+
+#include "time/timer.h"
+
+#include <thread>
+#include <vector>
+
+namespace Benchmark::Queue
+{
+  double Test(Async::Queue<uint_t>& queue, uint_t producers, uint_t consumers, uint_t items)
+  {
+    const auto perProducer = items / producers;
+    std::vector<std::thread> threads;
+    const Time::Timer timer;
+    for (uint_t idx = 0; idx != consumers; ++idx)
+    {
+      threads.emplace_back([&queue]() {
+        for (uint_t val = 0; queue.Get(val);)
+        {
+        }
+      });
+    }
+    for (uint_t idx = 0; idx != producers; ++idx)
+    {
+      threads.emplace_back([&queue, perProducer]() {
+        for (uint_t val = 0; val != perProducer; ++val)
+        {
+          queue.Add(val);
+        }
+      });
+    }
+    for (auto it = threads.begin() + consumers; it != threads.end(); ++it)
+    {
+      it->join();
+    }
+    queue.Flush();
+    queue.Reset();
+    const auto elapsed = timer.Elapsed<Time::Microsecond>();
+    for (auto it = threads.begin(); it != threads.begin() + consumers; ++it)
+    {
+      it->join();
+    }
+    return elapsed.Get() ? double(perProducer * producers) / elapsed.Get() : 0;
+  }
+}  // namespace Benchmark::Queue
@@ -0,0 +1,21 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Async queues test interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "async/queue.h"
+
+#include "types.h"
+
+namespace Benchmark::Queue
+{
+  //! @return Millions of items per second passed through queue
+  double Test(Async::Queue<uint_t>& queue, uint_t producers, uint_t consumers, uint_t items);
+}  // namespace Benchmark::Queue
@@ -0,0 +1,106 @@
+/**
+ *
+ * @file
+ *
+ * @brief  SAA test implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "saa.h"
+
+#include "time/timer.h"
+
+#include "make_ptr.h"
+
+namespace
+{
+  class SAAParameters : public Devices::SAA::ChipParameters
+  {
+  public:
+    SAAParameters(uint64_t clockFreq, uint_t soundFreq, Devices::SAA::InterpolationType interpolate)
+      : Clock(clockFreq)
+      , Sound(soundFreq)
+      , Interpolate(interpolate)
+    {}
+
+    uint_t Version() const override
+    {
+      return 1;
+    }
+
+    uint64_t ClockFreq() const override
+    {
+      return Clock;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return Sound;
+    }
+
+    Devices::SAA::InterpolationType Interpolation() const override
+    {
+      return Interpolate;
+    }
+
+  private:
+    const uint64_t Clock;
+    const uint_t Sound;
+    const Devices::SAA::InterpolationType Interpolate;
+  };
+}  // namespace
+
+namespace Benchmark::SAA
+{
+  Devices::SAA::Chip::Ptr CreateDevice(uint64_t clockFreq, uint_t soundFreq,
+                                       Devices::SAA::InterpolationType interpolate)
+  {
+    auto params = MakePtr<SAAParameters>(clockFreq, soundFreq, interpolate);
+    return Devices::SAA::CreateChip(std::move(params));
+  }
+
+  double Test(Devices::SAA::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration)
+  {
+    using namespace Devices::SAA;
+    const Time::Timer timer;
+    DataChunk chunk;
+    auto& regs = chunk.Data;
+    // all the tones, noise for the 1st and 4th channels, envelope on the 3rd and 6th channels
+    regs.Data[Registers::TONEMIXER] = 0x3f;
+    regs.Data[Registers::NOISEMIXER] = 0x09;
+    regs.Data[Registers::NOISECLOCK] = 0x31;
+    for (uint_t chan = 0; chan != 6; ++chan)
+    {
+      regs.Data[Registers::LEVEL0 + chan] = 0x8f - chan;
+    }
+    regs.Mask = ~uint32_t(0);
+    dev.RenderData(chunk);
+    const auto period = frameDuration.CastTo<TimeUnit>();
+    const auto frames = duration.Divide<uint_t>(frameDuration);
+    for (uint_t val = 0; val != frames; ++val)
+    {
+      for (uint_t chan = 0; chan != 6; ++chan)
+      {
+        regs.Data[Registers::TONENUMBER0 + chan] = (val + chan * 40) & 0xff;
+      }
+      const uint_t octave = (val >> 8) & 7;
+      regs.Data[Registers::TONEOCTAVE01] = regs.Data[Registers::TONEOCTAVE23] = regs.Data[Registers::TONEOCTAVE45] =
+          octave | (((octave + 2) & 7) << 4);
+      regs.Data[Registers::ENVELOPE0] = regs.Data[Registers::ENVELOPE1] = 0x80 | ((val >> 11) & 0x1e);
+      regs.Mask = (1 << Registers::TONENUMBER0) | (1 << Registers::TONENUMBER1) | (1 << Registers::TONENUMBER2)
+                  | (1 << Registers::TONENUMBER3) | (1 << Registers::TONENUMBER4) | (1 << Registers::TONENUMBER5)
+                  | (1 << Registers::TONEOCTAVE01) | (1 << Registers::TONEOCTAVE23) | (1 << Registers::TONEOCTAVE45);
+      if ((val & 0x7ff) == 0)
+      {
+        regs.Mask |= (1 << Registers::ENVELOPE0) | (1 << Registers::ENVELOPE1);
+      }
+      dev.RenderData(chunk);
+      chunk.TimeStamp += period;
+      dev.RenderTill(chunk.TimeStamp);
+    }
+    const auto elapsed = timer.Elapsed<TimeUnit>();
+    return double(chunk.TimeStamp.Get()) / elapsed.Get();
+  }
+}  // namespace Benchmark::SAA
@@ -0,0 +1,22 @@
+/**
+ *
+ * @file
+ *
+ * @brief  SAA test interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "devices/saa.h"
+
+#include "time/duration.h"
+
+namespace Benchmark::SAA
+{
+  Devices::SAA::Chip::Ptr CreateDevice(uint64_t clockFreq, uint_t soundFreq,
+                                       Devices::SAA::InterpolationType interpolate);
+  double Test(Devices::SAA::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration);
+}  // namespace Benchmark::SAA
@@ -10,7 +10,10 @@
 
 #include "core/benchmark.h"
 
+#include "error.h"
+
 #include <iostream>
+#include <vector>
 
 namespace
 {
@@ -25,7 +28,13 @@ namespace
         std::cout << "Test for " << cat << std::endl;
         LastCategory = cat;
       }
-      std::cout << " " << test.Name() << ": " << std::flush << 'x' << test.Execute() << std::endl;
+      std::cout << " " << test.Name() << ": " << std::flush << 'x' << test.Execute();
+      const auto details = test.Details();
+      if (!details.empty())
+      {
+        std::cout << " (" << details << ')';
+      }
+      std::cout << std::endl;
     }
 
   private:
@@ -33,8 +42,20 @@ namespace
   };
 }  // namespace
 
-int main()
+int main(int argc, char* argv[])
 {
-  ExecuteTestsVisitor visitor;
-  Benchmark::ForAllTests(visitor);
+  try
+  {
+    ExecuteTestsVisitor visitor;
+    Benchmark::ForAllTests(visitor);
+    // modules to test playback on are passed via command line
+    const std::vector<std::string> modules(argv + 1, argv + argc);
+    Benchmark::ForAllModulesTests(modules, visitor);
+    return 0;
+  }
+  catch (const Error& e)
+  {
+    std::cout << e.ToString();
+    return 1;
+  }
 }
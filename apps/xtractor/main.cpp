@@ -9,6 +9,7 @@
  **/
 
 #include "formats/archived/decoders.h"
+#include "formats/archived/prefetch.h"
 #include "formats/chiptune/decoders.h"
 #include "formats/image/decoders.h"
 #include "formats/packed/decoders.h"
@@ -20,6 +21,7 @@
 #include "async/data_receiver.h"
 #include "binary/format_factories.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "io/api.h"
 #include "io/providers_parameters.h"
 #include "parameters/container.h"
@@ -532,10 +534,12 @@ namespace
   class NestedScannerTarget : public Analysis::Scanner::Target
   {
   public:
-    NestedScannerTarget(Analysis::Node::Ptr root, Analysis::NodeReceiver& toScan, Analysis::NodeReceiver& toStore)
+    NestedScannerTarget(Analysis::Node::Ptr root, Analysis::NodeReceiver& toScan, Analysis::NodeReceiver& toStore,
+                        uint_t extractThreads)
       : Root(std::move(root))
       , ToScan(toScan)
       , ToStore(toStore)
+      , ExtractThreads(extractThreads)
     {}
 
     void Apply(const Formats::Archived::Decoder& decoder, std::size_t offset,
@@ -545,7 +549,7 @@ namespace
       Dbg("Found {0} in {1} bytes at {2}", name, data->Size(), offset);
       auto archNode = Analysis::CreateSubnode(Root, data, name, offset);
       const ScanFiles walker(ToScan, std::move(archNode));
-      data->ExploreFiles(walker);
+      Formats::Archived::ExploreFilesPrefetched(*data, walker, ExtractThreads, MAX_PREFETCH_SIZE);
     }
 
     void Apply(const Formats::Packed::Decoder& decoder, std::size_t offset,
@@ -607,16 +611,20 @@ namespace
     };
 
   private:
+    static const std::size_t MAX_PREFETCH_SIZE = 64 << 20;
+
     const Analysis::Node::Ptr Root;
     Analysis::NodeReceiver& ToScan;
     Analysis::NodeReceiver& ToStore;
+    const uint_t ExtractThreads;
   };
 
   class AnalysisTarget : public Analysis::NodeTransceiver
   {
   public:
-    explicit AnalysisTarget(bool skipChiptunes)
+    AnalysisTarget(bool skipChiptunes, uint_t extractThreads)
       : Scanner(Analysis::CreateScanner())
+      , ExtractThreads(extractThreads)
     {
       Formats::Archived::FillScanner(*Scanner);
       Formats::Packed::FillScanner(skipChiptunes, *Scanner);
@@ -630,7 +638,7 @@ namespace
     void ApplyData(Analysis::Node::Ptr node) override
     {
       Dbg("Analyze {}", node->Name());
-      NestedScannerTarget target(node, *this, *Target);
+      NestedScannerTarget target(node, *this, *Target, ExtractThreads);
       try
       {
         Scanner->Scan(node->Data(), target);
@@ -653,6 +661,7 @@ namespace
 
   private:
     const Analysis::Scanner::RWPtr Scanner;
+    const uint_t ExtractThreads;
     Analysis::NodeReceiver::Ptr Target;
   };
 }  // namespace
@@ -678,7 +687,12 @@ namespace
     OpenPointImpl()
       : Analyse(Analysis::NodeReceiver::CreateStub())
       , Params(Parameters::Container::Create())
-    {}
+    {
+      // whole files are scanned sequentially
+      using namespace Parameters::ZXTune::IO::Providers::File;
+      Params->SetValue(MMAP_THRESHOLD, 0);
+      Params->SetValue(MMAP_ADVICE, MMAP_ADVICE_SEQUENTIAL);
+    }
 
     void ApplyData(String filename) override
     {
@@ -708,7 +722,7 @@ namespace
 
   private:
     Analysis::NodeReceiver::Ptr Analyse;
-    const Parameters::Accessor::Ptr Params;
+    const Parameters::Container::Ptr Params;
   };
 
   class PathTemplate : public Strings::FieldsSource
@@ -955,6 +969,7 @@ namespace
     virtual std::size_t AnalysisThreads() const = 0;
     virtual std::size_t AnalysisDataQueueSize() const = 0;
     virtual bool SkipChiptunes() const = 0;
+    virtual uint_t ExtractThreads() const = 0;
   };
 
   class PipelineBuilder
@@ -1051,7 +1066,7 @@ namespace
 
   Analysis::NodeTransceiver::Ptr CreateAnalyser(const AnalysisOptions& opts)
   {
-    const Analysis::NodeTransceiver::Ptr analyser = MakePtr<AnalysisTarget>(opts.SkipChiptunes());
+    const Analysis::NodeTransceiver::Ptr analyser = MakePtr<AnalysisTarget>(opts.SkipChiptunes(), opts.ExtractThreads());
     const Analysis::NodeReceiver::Ptr input =
         AsyncWrap<Analysis::Node::Ptr>(opts.AnalysisThreads(), opts.AnalysisDataQueueSize(), analyser);
     return MakePtr<TransceivePipe<Analysis::Node::Ptr> >(input, analyser);
@@ -1086,6 +1101,10 @@ namespace
                           AnalysisDataQueueSizeValue)
               .c_str());
       opt("skip-chiptunes", bool_switch(&SkipChiptunesValue), "do not parse chiptunes");
+      opt("extract-threads", value<uint_t>(&ExtractThreadsValue),
+          Strings::Format("threads count for archived files extraction in background. 0 to disable. Default is {}",
+                          ExtractThreadsValue)
+              .c_str());
       opt("target-name-template", value<String>(&TargetNameTemplateValue),
           Strings::Format("target name template. Default is {0}. "
                           "Applicable fields: [{1}],[{2}],[{3}],[{4}],[{5}]",
@@ -1123,6 +1142,11 @@ namespace
       return SkipChiptunesValue;
     }
 
+    uint_t ExtractThreads() const override
+    {
+      return ExtractThreadsValue;
+    }
+
     String TargetNameTemplate() const override
     {
       return TargetNameTemplateValue;
@@ -1167,6 +1191,7 @@ namespace
     std::size_t AnalysisThreadsValue = 1;
     std::size_t AnalysisDataQueueSizeValue = 10;
     bool SkipChiptunesValue = false;
+    uint_t ExtractThreadsValue = 0;
     String TargetNameTemplateValue;
     bool IgnoreEmptyDataValue = false;
     std::size_t MinDataSizeValue = 0;
@@ -1190,6 +1215,11 @@ public:
     {
       return 1;
     }
+    if (!TraceFile.empty() && !Metrics::StartTrace(TraceFile))
+    {
+      std::cout << "Failed to create trace file " << TraceFile << std::endl;
+      return 1;
+    }
 
     /*
 
@@ -1212,20 +1242,29 @@ public:
       input->ApplyData(p);
     }
     input->Flush();
+    Metrics::StopTrace();
+    if (DumpMetrics)
+    {
+      std::cout << Metrics::MakeReport() << std::flush;
+    }
     return 0;
   }
 
 private:
-  bool ParseCmdline(Strings::Array args, Strings::Array& paths) const
+  bool ParseCmdline(Strings::Array args, Strings::Array& paths)
   {
     using namespace boost::program_options;
     const auto* const helpKey = "help";
     const auto* const inputKey = "input";
     const auto* const versionKey = "version";
+    const auto* const metricsKey = "metrics";
+    const auto* const traceKey = "trace";
     options_description options(Strings::Format("Usage:\n{0} [options] [--{1}] <input paths>", args[0], inputKey));
     auto opt = options.add_options();
     opt(helpKey, "show this message");
     opt(versionKey, "show application version");
+    opt(metricsKey, bool_switch(&DumpMetrics), "output collected performance metrics at exit");
+    opt(traceKey, value<String>(&TraceFile), "store timings to specified file in Chrome trace event format");
     options.add(Opts.GetOptionsDescription());
     opt(inputKey, value<Strings::Array>(&paths), "source files and directories to be processed");
     positional_options_description inputPositional;
@@ -1252,6 +1291,8 @@ private:
 
 private:
   const Options Opts;
+  bool DumpMetrics = false;
+  String TraceFile;
 };
 
 namespace Platform
@@ -74,6 +74,20 @@ namespace Parameters::ZXTuneQT::Playlist
     //@}
   }  // namespace Cache
 
+  namespace Scan
+  {
+    const auto PREFIX = Playlist::PREFIX + "Scan"_id;
+
+    //@{
+    //! @name Simultaneously scanned files count, 0 to use all the available cores
+
+    //! Parameter name
+    const auto THREADS = PREFIX + "Threads"_id;
+    //! Default value- single thread until parallel scanning is proven on real playlists
+    const IntType THREADS_DEFAULT = 1;
+    //@}
+  }  // namespace Scan
+
   namespace Store
   {
     const auto PREFIX = Playlist::PREFIX + "Store"_id;
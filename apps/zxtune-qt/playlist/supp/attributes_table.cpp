@@ -0,0 +1,522 @@
+/**
+ *
+ * @file
+ *
+ * @brief Playlist items attributes columnar storage implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "apps/zxtune-qt/playlist/supp/attributes_table.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+  using Playlist::Item::AttributesTable;
+
+  const uint_t NOT_FILLED = ~uint_t(0);
+  const AttributesTable::StringId NOT_MAPPED = ~AttributesTable::StringId(0);
+
+  template<class T>
+  void ReorderColumn(std::vector<T>& column, const std::vector<std::size_t>& rows)
+  {
+    std::vector<T> result;
+    result.reserve(rows.size());
+    for (const auto row : rows)
+    {
+      result.push_back(column[row]);
+    }
+    column.swap(result);
+  }
+
+  template<class T>
+  std::vector<std::size_t> SortRows(const std::vector<T>& keys, bool ascending)
+  {
+    using Entry = std::pair<T, std::size_t>;
+    std::vector<Entry> entries;
+    entries.reserve(keys.size());
+    for (std::size_t row = 0, lim = keys.size(); row != lim; ++row)
+    {
+      entries.emplace_back(keys[row], row);
+    }
+    if (ascending)
+    {
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const Entry& lh, const Entry& rh) { return lh.first < rh.first; });
+    }
+    else
+    {
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const Entry& lh, const Entry& rh) { return rh.first < lh.first; });
+    }
+    std::vector<std::size_t> result;
+    result.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+      result.push_back(entry.second);
+    }
+    return result;
+  }
+
+  bool IsAscii(uint8_t sym)
+  {
+    return sym < 0x80;
+  }
+
+  uint8_t FoldAscii(uint8_t sym)
+  {
+    return sym >= 'A' && sym <= 'Z' ? sym + ('a' - 'A') : sym;
+  }
+
+  String FoldAscii(StringView str)
+  {
+    String result(str);
+    std::transform(result.begin(), result.end(), result.begin(), [](char sym) { return FoldAscii(sym); });
+    return result;
+  }
+
+  // Trigrams of the ascii-only fragments with folded case, unique
+  std::vector<uint32_t> GetTrigrams(StringView str)
+  {
+    std::vector<uint32_t> result;
+    for (std::size_t pos = 0; pos + 3 <= str.size(); ++pos)
+    {
+      const auto s0 = static_cast<uint8_t>(str[pos]);
+      const auto s1 = static_cast<uint8_t>(str[pos + 1]);
+      const auto s2 = static_cast<uint8_t>(str[pos + 2]);
+      if (IsAscii(s0) && IsAscii(s1) && IsAscii(s2))
+      {
+        result.push_back(uint32_t(FoldAscii(s0)) | (uint32_t(FoldAscii(s1)) << 8) | (uint32_t(FoldAscii(s2)) << 16));
+      }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+  // Ascending identifiers stored as varint-encoded deltas
+  class PostingList
+  {
+  public:
+    void Add(AttributesTable::StringId id)
+    {
+      for (auto delta = id - Last; ; delta >>= 7)
+      {
+        if (delta < 0x80)
+        {
+          Data.push_back(static_cast<uint8_t>(delta));
+          break;
+        }
+        Data.push_back(static_cast<uint8_t>(delta | 0x80));
+      }
+      Last = id;
+      ++Count;
+    }
+
+    std::size_t Size() const
+    {
+      return Count;
+    }
+
+    template<class F>
+    void ForEach(F&& cb) const
+    {
+      AttributesTable::StringId id = 0;
+      for (auto it = Data.begin(), lim = Data.end(); it != lim;)
+      {
+        AttributesTable::StringId delta = 0;
+        for (uint_t shift = 0;; shift += 7)
+        {
+          const auto part = *it++;
+          delta |= AttributesTable::StringId(part & 0x7f) << shift;
+          if (part < 0x80)
+          {
+            break;
+          }
+        }
+        id += delta;
+        cb(id);
+      }
+    }
+
+  private:
+    std::vector<uint8_t> Data;
+    AttributesTable::StringId Last = 0;
+    std::size_t Count = 0;
+  };
+
+  class TrigramsIndex
+  {
+  public:
+    void Update(const std::vector<const String*>& values)
+    {
+      for (const auto lim = values.size(); Indexed < lim; ++Indexed)
+      {
+        const auto id = static_cast<AttributesTable::StringId>(Indexed);
+        const StringView str = *values[Indexed];
+        for (const auto trigram : GetTrigrams(str))
+        {
+          Postings[trigram].Add(id);
+        }
+        if (!std::all_of(str.begin(), str.end(), [](char sym) { return IsAscii(sym); }))
+        {
+          NonAscii.push_back(id);
+        }
+      }
+    }
+
+    //! @return flags of strings possibly containing substring or empty if there are no restrictions
+    std::vector<bool> Find(StringView substring, bool caseSensitive) const
+    {
+      const auto trigrams = GetTrigrams(substring);
+      if (trigrams.empty())
+      {
+        return {};
+      }
+      std::vector<const PostingList*> lists;
+      for (const auto trigram : trigrams)
+      {
+        const auto it = Postings.find(trigram);
+        if (it == Postings.end())
+        {
+          lists.clear();
+          break;
+        }
+        lists.push_back(&it->second);
+      }
+      std::vector<bool> result(Indexed);
+      if (!lists.empty())
+      {
+        std::sort(lists.begin(), lists.end(),
+                  [](const PostingList* lh, const PostingList* rh) { return lh->Size() < rh->Size(); });
+        std::vector<AttributesTable::StringId> ids;
+        ids.reserve(lists.front()->Size());
+        lists.front()->ForEach([&ids](AttributesTable::StringId id) { ids.push_back(id); });
+        for (auto it = lists.begin() + 1, lim = lists.end(); it != lim && !ids.empty(); ++it)
+        {
+          auto out = ids.begin();
+          auto cur = ids.cbegin();
+          const auto end = ids.cend();
+          (*it)->ForEach([&out, &cur, end](AttributesTable::StringId id) {
+            for (; cur != end && *cur < id; ++cur)
+            {}
+            if (cur != end && *cur == id)
+            {
+              *out++ = *cur++;
+            }
+          });
+          ids.erase(out, ids.end());
+        }
+        for (const auto id : ids)
+        {
+          result[id] = true;
+        }
+      }
+      // case folding for non-ascii symbols is not tracked, so such strings are always the candidates
+      if (!caseSensitive)
+      {
+        for (const auto id : NonAscii)
+        {
+          result[id] = true;
+        }
+      }
+      return result;
+    }
+
+  private:
+    std::size_t Indexed = 0;
+    std::unordered_map<uint32_t, PostingList> Postings;
+    std::vector<AttributesTable::StringId> NonAscii;
+  };
+
+  // Per-string results of the last substring search. Strings not matched by query are not matched by any extended one.
+  class SearchResults
+  {
+  public:
+    enum State : uint8_t
+    {
+      UNKNOWN,
+      MATCHED,
+      MISMATCHED
+    };
+
+    SearchResults() = default;
+
+    SearchResults(String query, bool caseSensitive, std::size_t size)
+      : Query(std::move(query))
+      , CaseSensitive(caseSensitive)
+      , States(size, UNKNOWN)
+    {}
+
+    void InheritMismatches(const SearchResults& prev)
+    {
+      if (!prev.Query.empty() && prev.CaseSensitive == CaseSensitive && Query.find(prev.Query) != String::npos)
+      {
+        for (std::size_t idx = 0, lim = prev.States.size(); idx != lim; ++idx)
+        {
+          if (prev.States[idx] == MISMATCHED)
+          {
+            States[idx] = MISMATCHED;
+          }
+        }
+      }
+    }
+
+    const String& GetQuery() const
+    {
+      return Query;
+    }
+
+    State& operator[](AttributesTable::StringId id)
+    {
+      return States[id];
+    }
+
+  private:
+    String Query;
+    bool CaseSensitive = false;
+    std::vector<State> States;
+  };
+}  // namespace
+
+namespace Playlist::Item
+{
+  class AttributesTable::StringsPool
+  {
+  public:
+    StringId Intern(String str)
+    {
+      const std::scoped_lock lock(Guard);
+      const auto res = Ids.emplace(std::move(str), static_cast<StringId>(Values.size()));
+      if (res.second)
+      {
+        Values.push_back(&res.first->first);
+      }
+      return res.first->second;
+    }
+
+    StringView Get(StringId id) const
+    {
+      const std::scoped_lock lock(Guard);
+      return *Values[id];
+    }
+
+    std::size_t Size() const
+    {
+      const std::scoped_lock lock(Guard);
+      return Values.size();
+    }
+
+    //! @return lexicographical order of the each string instead of identifier
+    std::vector<uint32_t> Rank(const std::vector<StringId>& ids) const
+    {
+      std::vector<StringId> distinct(ids);
+      std::sort(distinct.begin(), distinct.end());
+      distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+      std::vector<uint32_t> ranks;
+      {
+        const std::scoped_lock lock(Guard);
+        std::sort(distinct.begin(), distinct.end(),
+                  [this](StringId lh, StringId rh) { return *Values[lh] < *Values[rh]; });
+        ranks.resize(Values.size());
+      }
+      for (std::size_t idx = 0, lim = distinct.size(); idx != lim; ++idx)
+      {
+        ranks[distinct[idx]] = static_cast<uint32_t>(idx);
+      }
+      std::vector<uint32_t> result;
+      result.reserve(ids.size());
+      for (const auto id : ids)
+      {
+        result.push_back(ranks[id]);
+      }
+      return result;
+    }
+
+    std::vector<bool> Match(const std::vector<StringId>& ids, const StringsMatcher& matcher, Log::ProgressCallback& cb)
+    {
+      const std::scoped_lock lock(Guard);
+      std::vector<bool> result(Values.size());
+      const auto substring = matcher.GetSubstring();
+      if (substring.empty())
+      {
+        uint_t done = 0;
+        for (const auto id : ids)
+        {
+          result[id] = matcher.Match(*Values[id]);
+          cb.OnProgress(++done);
+        }
+        return result;
+      }
+      Index.Update(Values);
+      const auto caseSensitive = matcher.IsCaseSensitive();
+      SearchResults current(caseSensitive ? String(substring) : FoldAscii(substring), caseSensitive, Values.size());
+      current.InheritMismatches(LastSearch);
+      const auto candidates = Index.Find(current.GetQuery(), caseSensitive);
+      uint_t done = 0;
+      for (const auto id : ids)
+      {
+        auto& state = current[id];
+        if (state != SearchResults::MISMATCHED)
+        {
+          const auto match = (candidates.empty() || candidates[id]) && matcher.Match(*Values[id]);
+          state = match ? SearchResults::MATCHED : SearchResults::MISMATCHED;
+          result[id] = match;
+        }
+        cb.OnProgress(++done);
+      }
+      LastSearch = std::move(current);
+      return result;
+    }
+
+  private:
+    mutable std::mutex Guard;
+    // nodes are not moved on rehash, so pointers to keys are stable
+    std::unordered_map<String, StringId> Ids;
+    std::vector<const String*> Values;
+    TrigramsIndex Index;
+    SearchResults LastSearch;
+  };
+
+  AttributesTable::AttributesTable()
+    : Strings(std::make_shared<StringsPool>())
+  {}
+
+  void AttributesTable::Append(std::size_t count)
+  {
+    const auto newSize = Size() + count;
+    Versions.resize(newSize, NOT_FILLED);
+    Types.resize(newSize);
+    Durations.resize(newSize);
+    Authors.resize(newSize);
+    Titles.resize(newSize);
+    Sizes.resize(newSize);
+    Checksums.resize(newSize);
+    CoreChecksums.resize(newSize);
+    Paths.resize(newSize);
+  }
+
+  bool AttributesTable::Refresh(std::size_t row, const Data& item)
+  {
+    const auto version = item.GetModuleProperties()->Version();
+    if (Versions[row] == version)
+    {
+      return false;
+    }
+    Versions[row] = version;
+    Types[row] = Strings->Intern(item.GetType());
+    Durations[row] = item.GetDuration();
+    Authors[row] = Strings->Intern(item.GetAuthor());
+    Titles[row] = Strings->Intern(item.GetTitle());
+    Sizes[row] = item.GetSize();
+    Checksums[row] = item.GetChecksum();
+    CoreChecksums[row] = item.GetCoreChecksum();
+    Paths[row] = Strings->Intern(item.GetFullPath());
+    return true;
+  }
+
+  void AttributesTable::Reorder(const std::vector<std::size_t>& rows)
+  {
+    const auto shrunk = rows.size() < Size();
+    ReorderColumn(Versions, rows);
+    ReorderColumn(Types, rows);
+    ReorderColumn(Durations, rows);
+    ReorderColumn(Authors, rows);
+    ReorderColumn(Titles, rows);
+    ReorderColumn(Sizes, rows);
+    ReorderColumn(Checksums, rows);
+    ReorderColumn(CoreChecksums, rows);
+    ReorderColumn(Paths, rows);
+    if (shrunk)
+    {
+      CompactStrings();
+    }
+  }
+
+  void AttributesTable::CompactStrings()
+  {
+    const auto total = Strings->Size();
+    std::vector<StringId> mapping(total, NOT_MAPPED);
+    std::size_t used = 0;
+    const auto columns = {&Types, &Authors, &Titles, &Paths};
+    for (const auto* column : columns)
+    {
+      for (std::size_t row = 0, lim = Size(); row != lim; ++row)
+      {
+        if (Versions[row] != NOT_FILLED)
+        {
+          auto& id = mapping[(*column)[row]];
+          if (id == NOT_MAPPED)
+          {
+            id = 0;
+            ++used;
+          }
+        }
+      }
+    }
+    if (used * 2 > total)
+    {
+      return;
+    }
+    // pool may be still used by copies, so build new one
+    auto strings = std::make_shared<StringsPool>();
+    std::fill(mapping.begin(), mapping.end(), NOT_MAPPED);
+    for (auto* column : columns)
+    {
+      for (std::size_t row = 0, lim = Size(); row != lim; ++row)
+      {
+        if (Versions[row] != NOT_FILLED)
+        {
+          auto& id = (*column)[row];
+          auto& mapped = mapping[id];
+          if (mapped == NOT_MAPPED)
+          {
+            mapped = strings->Intern(String(Strings->Get(id)));
+          }
+          id = mapped;
+        }
+      }
+    }
+    Strings = std::move(strings);
+  }
+
+  std::vector<std::size_t> AttributesTable::GetSortedRows(Column column, bool ascending) const
+  {
+    switch (column)
+    {
+    case Column::TYPE:
+      return SortRows(Strings->Rank(Types), ascending);
+    case Column::DURATION:
+      return SortRows(Durations, ascending);
+    case Column::AUTHOR:
+      return SortRows(Strings->Rank(Authors), ascending);
+    case Column::TITLE:
+      return SortRows(Strings->Rank(Titles), ascending);
+    case Column::SIZE:
+      return SortRows(Sizes, ascending);
+    case Column::CHECKSUM:
+      return SortRows(Checksums, ascending);
+    case Column::CORE_CHECKSUM:
+      return SortRows(CoreChecksums, ascending);
+    case Column::PATH:
+      return SortRows(Strings->Rank(Paths), ascending);
+    default:
+      return {};
+    }
+  }
+
+  std::vector<bool> AttributesTable::MatchStrings(const std::vector<StringId>& ids, const StringsMatcher& matcher,
+                                                  Log::ProgressCallback& cb) const
+  {
+    return Strings->Match(ids, matcher, cb);
+  }
+
+  StringView AttributesTable::GetString(StringId id) const
+  {
+    return Strings->Get(id);
+  }
+}  // namespace Playlist::Item
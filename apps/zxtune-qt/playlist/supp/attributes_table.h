@@ -0,0 +1,141 @@
+/**
+ *
+ * @file
+ *
+ * @brief Playlist items attributes columnar storage interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "apps/zxtune-qt/playlist/supp/data.h"
+
+#include "time/duration.h"
+#include "tools/progress_callback.h"
+
+#include "string_view.h"
+#include "types.h"
+
+#include <memory>
+#include <vector>
+
+namespace Playlist::Item
+{
+  /*
+    Copies of the most used items attributes stored as plain arrays (one per attribute) to perform bulk operations
+    without virtual calls and temporary strings. String attributes are interned, so each row keeps only the identifier.
+    Row is refreshed only when item properties version is changed. Strings pool is rebuilt when the most of its strings
+    are not used after rows removal.
+    Strings are searched using incrementally built trigrams index, results of the last plain substring search are used
+    to skip mismatched strings when query is extended.
+  */
+  class AttributesTable
+  {
+  public:
+    using StringId = uint32_t;
+
+    enum class Column
+    {
+      TYPE,
+      DURATION,
+      AUTHOR,
+      TITLE,
+      SIZE,
+      CHECKSUM,
+      CORE_CHECKSUM,
+      PATH
+    };
+
+    class StringsMatcher
+    {
+    public:
+      virtual ~StringsMatcher() = default;
+
+      //! Plain substring every matched string contains. Empty for another kinds of matching
+      virtual StringView GetSubstring() const = 0;
+      virtual bool IsCaseSensitive() const = 0;
+      virtual bool Match(StringView str) const = 0;
+    };
+
+    AttributesTable();
+
+    std::size_t Size() const
+    {
+      return Versions.size();
+    }
+
+    //! Adds specified count of not yet filled rows
+    void Append(std::size_t count);
+    //! @return true if row was (re)filled from item
+    bool Refresh(std::size_t row, const Data& item);
+    //! Leaves only specified rows in specified order
+    void Reorder(const std::vector<std::size_t>& rows);
+    //! @return rows order to get stable sorting by column
+    std::vector<std::size_t> GetSortedRows(Column column, bool ascending) const;
+
+    StringView GetString(StringId id) const;
+    //! @return matching flags indexed by string identifier, only specified strings are checked
+    std::vector<bool> MatchStrings(const std::vector<StringId>& ids, const StringsMatcher& matcher,
+                                   Log::ProgressCallback& cb) const;
+
+    const std::vector<StringId>& GetTypes() const
+    {
+      return Types;
+    }
+
+    const std::vector<Time::Milliseconds>& GetDurations() const
+    {
+      return Durations;
+    }
+
+    const std::vector<StringId>& GetAuthors() const
+    {
+      return Authors;
+    }
+
+    const std::vector<StringId>& GetTitles() const
+    {
+      return Titles;
+    }
+
+    const std::vector<std::size_t>& GetSizes() const
+    {
+      return Sizes;
+    }
+
+    const std::vector<uint32_t>& GetChecksums() const
+    {
+      return Checksums;
+    }
+
+    const std::vector<uint32_t>& GetCoreChecksums() const
+    {
+      return CoreChecksums;
+    }
+
+    const std::vector<StringId>& GetPaths() const
+    {
+      return Paths;
+    }
+
+  private:
+    //! Replaces strings pool by the new one with used strings only if the most of them are not used anymore
+    void CompactStrings();
+
+  private:
+    class StringsPool;
+    // shared between copies, only grows
+    std::shared_ptr<StringsPool> Strings;
+    std::vector<uint_t> Versions;
+    std::vector<StringId> Types;
+    std::vector<Time::Milliseconds> Durations;
+    std::vector<StringId> Authors;
+    std::vector<StringId> Titles;
+    std::vector<std::size_t> Sizes;
+    std::vector<uint32_t> Checksums;
+    std::vector<uint32_t> CoreChecksums;
+    std::vector<StringId> Paths;
+  };
+}  // namespace Playlist::Item
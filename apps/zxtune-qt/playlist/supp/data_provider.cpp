@@ -251,7 +251,6 @@ namespace
 
     Binary::Container::Ptr GetData(StringView dataPath) const override
     {
-      const std::lock_guard<std::mutex> lock(Mutex);
       const std::size_t filesLimit = Params.FilesLimit();
       const std::size_t memLimit = Params.MemoryLimit();
       if (filesLimit != 0 && memLimit != 0)
@@ -260,7 +259,10 @@ namespace
       }
       else
       {
-        Cache.Clear();
+        {
+          const std::lock_guard<std::mutex> lock(Mutex);
+          Cache.Clear();
+        }
         return Delegate->GetData(dataPath);
       }
     }
@@ -278,11 +280,21 @@ namespace
   private:
     Binary::Container::Ptr GetCachedData(StringView dataPath, std::size_t filesLimit, std::size_t memLimit) const
     {
+      {
+        const std::lock_guard<std::mutex> lock(Mutex);
+        if (auto cached = Cache.Find(dataPath))
+        {
+          return cached;
+        }
+      }
+      // do not block other scanning threads while reading
+      auto data = Delegate->GetData(dataPath);
+      const std::lock_guard<std::mutex> lock(Mutex);
+      // the same file may be read concurrently
       if (auto cached = Cache.Find(dataPath))
       {
         return cached;
       }
-      auto data = Delegate->GetData(dataPath);
       Cache.Add(dataPath, data);
       Cache.Fit(filesLimit, memLimit);
       ReportCache();
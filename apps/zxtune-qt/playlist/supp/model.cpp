@@ -33,6 +33,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <optional>
 #include <utility>
 
 namespace
@@ -164,26 +165,37 @@ namespace
   {
     switch (column)
     {
-    case Playlist::Model::COLUMN_TYPE:
-      return CreateComparer(&Playlist::Item::Data::GetType, ascending);
     case Playlist::Model::COLUMN_DISPLAY_NAME:
       return CreateComparer(&Playlist::Item::Data::GetDisplayName, ascending);
+    case Playlist::Model::COLUMN_COMMENT:
+      return CreateComparer(&Playlist::Item::Data::GetComment, ascending);
+    default:
+      return {};
+    }
+  }
+
+  // columns available in attributes table are sorted without comparer
+  std::optional<Playlist::Item::AttributesTable::Column> GetAttributeByColumn(int column)
+  {
+    using Attribute = Playlist::Item::AttributesTable::Column;
+    switch (column)
+    {
+    case Playlist::Model::COLUMN_TYPE:
+      return Attribute::TYPE;
     case Playlist::Model::COLUMN_DURATION:
-      return CreateComparer(&Playlist::Item::Data::GetDuration, ascending);
+      return Attribute::DURATION;
     case Playlist::Model::COLUMN_AUTHOR:
-      return CreateComparer(&Playlist::Item::Data::GetAuthor, ascending);
+      return Attribute::AUTHOR;
     case Playlist::Model::COLUMN_TITLE:
-      return CreateComparer(&Playlist::Item::Data::GetTitle, ascending);
-    case Playlist::Model::COLUMN_COMMENT:
-      return CreateComparer(&Playlist::Item::Data::GetComment, ascending);
-    case Playlist::Model::COLUMN_PATH:
-      return CreateComparer(&Playlist::Item::Data::GetFullPath, ascending);
+      return Attribute::TITLE;
     case Playlist::Model::COLUMN_SIZE:
-      return CreateComparer(&Playlist::Item::Data::GetSize, ascending);
+      return Attribute::SIZE;
     case Playlist::Model::COLUMN_CRC:
-      return CreateComparer(&Playlist::Item::Data::GetChecksum, ascending);
+      return Attribute::CHECKSUM;
     case Playlist::Model::COLUMN_FIXEDCRC:
-      return CreateComparer(&Playlist::Item::Data::GetCoreChecksum, ascending);
+      return Attribute::CORE_CHECKSUM;
+    case Playlist::Model::COLUMN_PATH:
+      return Attribute::PATH;
     default:
       return {};
     }
@@ -230,6 +242,27 @@ namespace
     const Playlist::Item::Comparer::Ptr Comparer;
   };
 
+  class SortByAttributeOperation : public Playlist::Item::StorageModifyOperation
+  {
+  public:
+    SortByAttributeOperation(Playlist::Item::AttributesTable::Column column, bool ascending)
+      : Column(column)
+      , Ascending(ascending)
+    {}
+
+    void Execute(Playlist::Item::Storage& storage, Log::ProgressCallback& cb) override
+    {
+      // sorting itself is fast, so report only attributes refreshing
+      Log::PercentProgressCallback progress(static_cast<uint_t>(storage.CountItems()), cb);
+      storage.GetAttributes(progress);
+      storage.Sort(Column, Ascending);
+    }
+
+  private:
+    const Playlist::Item::AttributesTable::Column Column;
+    const bool Ascending;
+  };
+
   const QLatin1String INDICES_MIMETYPE("application/playlist.indices");
 
   template<class OpType>
@@ -626,7 +659,11 @@ namespace
     {
       Dbg("Sort data in column={} by order={}", column, static_cast<int>(order));
       const bool ascending = order == Qt::AscendingOrder;
-      if (auto comparer = CreateComparerByColumn(column, ascending))
+      if (const auto attribute = GetAttributeByColumn(column))
+      {
+        PerformOperation(MakePtr<SortByAttributeOperation>(*attribute, ascending));
+      }
+      else if (auto comparer = CreateComparerByColumn(column, ascending))
       {
         auto op = MakePtr<SortOperation>(std::move(comparer));
         PerformOperation(std::move(op));
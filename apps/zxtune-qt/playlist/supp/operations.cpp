@@ -17,7 +17,10 @@
 
 #include "make_ptr.h"
 
+#include <functional>
 #include <numeric>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace
 {
@@ -42,13 +45,39 @@ namespace
     virtual void ForSpecifiedItems(const Playlist::Model::IndexSet& items, Visitor& visitor) const = 0;
   };
 
+  template<class T>
+  using PropertyGetter = std::function<T(Playlist::Model::IndexType, const Playlist::Item::Data&)>;
+
+  template<class T>
+  PropertyGetter<T> GetFromItem(T (Playlist::Item::Data::*getter)() const)
+  {
+    return [getter](Playlist::Model::IndexType /*index*/, const Playlist::Item::Data& data) {
+      return (data.*getter)();
+    };
+  }
+
+  template<class T>
+  PropertyGetter<T> GetFromColumn(const std::vector<T>& column)
+  {
+    return [&column](Playlist::Model::IndexType index, const Playlist::Item::Data& /*data*/) {
+      assert(index < column.size());
+      return column[index];
+    };
+  }
+
+  // attributes are refreshed in the first half of progress
+  const Playlist::Item::AttributesTable& GetAttributes(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb)
+  {
+    Log::NestedProgressCallback refreshing(2, 0, cb);
+    Log::PercentProgressCallback progress(static_cast<uint_t>(stor.CountItems()), refreshing);
+    return stor.GetAttributes(progress);
+  }
+
   template<class T>
   class VisitorAdapter : public Playlist::Item::Visitor
   {
   public:
-    using GetFunctionType = T (Playlist::Item::Data::*)() const;
-
-    VisitorAdapter(const GetFunctionType getter, typename PropertyModel<T>::Visitor& delegate)
+    VisitorAdapter(const PropertyGetter<T>& getter, typename PropertyModel<T>::Visitor& delegate)
       : Getter(getter)
       , Delegate(delegate)
     {}
@@ -60,12 +89,12 @@ namespace
       {
         return;
       }
-      const T val = ((*data).*Getter)();
+      const T val = Getter(index, *data);
       Delegate.OnItem(index, val);
     }
 
   private:
-    const GetFunctionType Getter;
+    const PropertyGetter<T>& Getter;
     typename PropertyModel<T>::Visitor& Delegate;
   };
 
@@ -73,9 +102,9 @@ namespace
   class TypedPropertyModel : public PropertyModel<T>
   {
   public:
-    TypedPropertyModel(const Playlist::Item::Storage& model, const typename VisitorAdapter<T>::GetFunctionType getter)
+    TypedPropertyModel(const Playlist::Item::Storage& model, PropertyGetter<T> getter)
       : Model(model)
-      , Getter(getter)
+      , Getter(std::move(getter))
     {}
 
     std::size_t CountItems() const override
@@ -99,7 +128,7 @@ namespace
 
   private:
     const Playlist::Item::Storage& Model;
-    const typename VisitorAdapter<T>::GetFunctionType Getter;
+    const PropertyGetter<T> Getter;
   };
 
   template<class T>
@@ -161,7 +190,7 @@ namespace
   class PropertiesFilter : public PropertyModel<T>::Visitor
   {
   public:
-    PropertiesFilter(typename PropertyModel<T>::Visitor& delegate, const std::set<T>& filter)
+    PropertiesFilter(typename PropertyModel<T>::Visitor& delegate, const std::unordered_set<T>& filter)
       : Delegate(delegate)
       , Filter(filter)
     {}
@@ -176,7 +205,7 @@ namespace
 
   private:
     typename PropertyModel<T>::Visitor& Delegate;
-    const std::set<T>& Filter;
+    const std::unordered_set<T>& Filter;
   };
 
   template<class T>
@@ -188,13 +217,13 @@ namespace
       Result.insert(val);
     }
 
-    const std::set<T>& GetResult() const
+    const std::unordered_set<T>& GetResult() const
     {
       return Result;
     }
 
   private:
-    std::set<T> Result;
+    std::unordered_set<T> Result;
   };
 
   template<class T>
@@ -241,7 +270,7 @@ namespace
     }
 
   private:
-    std::set<T> Visited;
+    std::unordered_set<T> Visited;
     const Playlist::Model::IndexSet::RWPtr Result;
   };
 
@@ -270,7 +299,7 @@ namespace
     }
 
   private:
-    using PropToIndex = typename std::map<T, Playlist::Model::IndexType>;
+    using PropToIndex = typename std::unordered_map<T, Playlist::Model::IndexType>;
     PropToIndex Visited;
     const Playlist::Model::IndexSet::RWPtr Result;
   };
@@ -317,8 +346,10 @@ namespace
     {
       DuplicatesCollector<uint32_t> dups;
       {
-        const TypedPropertyModel<uint32_t> propertyModel(stor, &Playlist::Item::Data::GetChecksum);
-        VisitAllItems(propertyModel, cb, dups);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<uint32_t> propertyModel(stor, GetFromColumn(attributes.GetChecksums()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitAllItems(propertyModel, visiting, dups);
       }
       emit ResultAcquired(dups.GetResult());
     }
@@ -335,8 +366,10 @@ namespace
     {
       ItemsWithDuplicatesCollector<uint32_t> dups;
       {
-        const TypedPropertyModel<uint32_t> propertyModel(stor, &Playlist::Item::Data::GetChecksum);
-        VisitAsSelectedItems(propertyModel, *SelectedItems, cb, dups);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<uint32_t> propertyModel(stor, GetFromColumn(attributes.GetChecksums()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitAsSelectedItems(propertyModel, *SelectedItems, visiting, dups);
       }
       // select all rips but delete only nonselected
       auto toRemove = dups.GetResult();
@@ -360,8 +393,10 @@ namespace
     {
       DuplicatesCollector<uint32_t> dups;
       {
-        const TypedPropertyModel<uint32_t> propertyModel(stor, &Playlist::Item::Data::GetChecksum);
-        VisitOnlySelectedItems(propertyModel, *SelectedItems, cb, dups);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<uint32_t> propertyModel(stor, GetFromColumn(attributes.GetChecksums()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitOnlySelectedItems(propertyModel, *SelectedItems, visiting, dups);
       }
       emit ResultAcquired(dups.GetResult());
     }
@@ -378,8 +413,10 @@ namespace
     {
       ItemsWithDuplicatesCollector<uint32_t> rips;
       {
-        const TypedPropertyModel<uint32_t> propertyModel(stor, &Playlist::Item::Data::GetCoreChecksum);
-        VisitAllItems(propertyModel, cb, rips);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<uint32_t> propertyModel(stor, GetFromColumn(attributes.GetCoreChecksums()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitAllItems(propertyModel, visiting, rips);
       }
       emit ResultAcquired(rips.GetResult());
     }
@@ -396,8 +433,10 @@ namespace
     {
       ItemsWithDuplicatesCollector<uint32_t> rips;
       {
-        const TypedPropertyModel<uint32_t> propertyModel(stor, &Playlist::Item::Data::GetCoreChecksum);
-        VisitAsSelectedItems(propertyModel, *SelectedItems, cb, rips);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<uint32_t> propertyModel(stor, GetFromColumn(attributes.GetCoreChecksums()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitAsSelectedItems(propertyModel, *SelectedItems, visiting, rips);
       }
       emit ResultAcquired(rips.GetResult());
     }
@@ -417,8 +456,10 @@ namespace
     {
       ItemsWithDuplicatesCollector<uint32_t> rips;
       {
-        const TypedPropertyModel<uint32_t> propertyModel(stor, &Playlist::Item::Data::GetCoreChecksum);
-        VisitOnlySelectedItems(propertyModel, *SelectedItems, cb, rips);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<uint32_t> propertyModel(stor, GetFromColumn(attributes.GetCoreChecksums()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitOnlySelectedItems(propertyModel, *SelectedItems, visiting, rips);
       }
       emit ResultAcquired(rips.GetResult());
     }
@@ -437,10 +478,13 @@ namespace
 
     void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
     {
-      IndicesCollector<String> types;
+      IndicesCollector<Playlist::Item::AttributesTable::StringId> types;
       {
-        const TypedPropertyModel<String> propertyModel(stor, &Playlist::Item::Data::GetType);
-        VisitAsSelectedItems(propertyModel, *SelectedItems, cb, types);
+        const auto& attributes = GetAttributes(stor, cb);
+        const TypedPropertyModel<Playlist::Item::AttributesTable::StringId> propertyModel(
+            stor, GetFromColumn(attributes.GetTypes()));
+        Log::NestedProgressCallback visiting(2, 1, cb);
+        VisitAsSelectedItems(propertyModel, *SelectedItems, visiting, types);
       }
       emit ResultAcquired(types.GetResult());
     }
@@ -460,7 +504,7 @@ namespace
     {
       IndicesCollector<String> files;
       {
-        const TypedPropertyModel<String> propertyModel(stor, &Playlist::Item::Data::GetFilePath);
+        const TypedPropertyModel<String> propertyModel(stor, GetFromItem(&Playlist::Item::Data::GetFilePath));
         VisitAsSelectedItems(propertyModel, *SelectedItems, cb, files);
       }
       emit ResultAcquired(files.GetResult());
@@ -21,116 +21,28 @@
 
 #include <QtCore/QRegExp>
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 namespace
 {
-  class Predicate
-  {
-  public:
-    using Ptr = std::shared_ptr<const Predicate>;
-    virtual ~Predicate() = default;
-
-    virtual bool Match(const Playlist::Item::Data& data) const = 0;
-  };
-
-  class SearchVisitor : public Playlist::Item::Visitor
-  {
-  public:
-    SearchVisitor(Predicate::Ptr pred, Log::ProgressCallback& cb)
-      : Callback(cb)
-      , Pred(std::move(pred))
-      , Result(MakeRWPtr<Playlist::Model::IndexSet>())
-    {}
-
-    void OnItem(Playlist::Model::IndexType index, Playlist::Item::Data::Ptr data) override
-    {
-      if (Pred->Match(*data))
-      {
-        Result->insert(index);
-      }
-      Callback.OnProgress(++Done);
-    }
+  using Playlist::Item::AttributesTable;
 
-    Playlist::Model::IndexSet::Ptr GetResult() const
-    {
-      return Result;
-    }
-
-  private:
-    Log::ProgressCallback& Callback;
-    const Predicate::Ptr Pred;
-    const Playlist::Model::IndexSet::RWPtr Result;
-    uint_t Done = 0;
-  };
-
-  class SearchOperation : public Playlist::Item::SelectionOperation
+  class StringPredicate : public AttributesTable::StringsMatcher
   {
   public:
-    explicit SearchOperation(Predicate::Ptr pred)
-      : Pred(std::move(pred))
-    {
-      Require(Pred != nullptr);
-    }
-
-    SearchOperation(Playlist::Model::IndexSet::Ptr items, Predicate::Ptr pred)
-      : SelectedItems(std::move(items))
-      , Pred(std::move(pred))
-    {
-      Require(Pred != nullptr);
-    }
+    using Ptr = std::shared_ptr<const StringPredicate>;
 
-    void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
+    StringView GetSubstring() const override
     {
-      const std::size_t totalItems = SelectedItems ? SelectedItems->size() : stor.CountItems();
-      Log::PercentProgressCallback progress(totalItems, cb);
-      SearchVisitor visitor(Pred, progress);
-      if (SelectedItems)
-      {
-        stor.ForSpecifiedItems(*SelectedItems, visitor);
-      }
-      else
-      {
-        stor.ForAllItems(visitor);
-      }
-      emit ResultAcquired(visitor.GetResult());
+      return {};
     }
 
-  private:
-    const Playlist::Model::IndexSet::Ptr SelectedItems;
-    const Predicate::Ptr Pred;
-  };
-
-  class StringPredicate
-  {
-  public:
-    using Ptr = std::shared_ptr<const StringPredicate>;
-    virtual ~StringPredicate() = default;
-
-    virtual bool Match(StringView str) const = 0;
-  };
-
-  class ScopePredicateDispatcher : public Predicate
-  {
-  public:
-    ScopePredicateDispatcher(StringPredicate::Ptr pred, uint_t scope)
-      : Pred(std::move(pred))
-      , MatchTitle(0 != (scope & Playlist::Item::Search::TITLE))
-      , MatchAuthor(0 != (scope & Playlist::Item::Search::AUTHOR))
-      , MatchPath(0 != (scope & Playlist::Item::Search::PATH))
-    {}
-
-    bool Match(const Playlist::Item::Data& data) const override
+    bool IsCaseSensitive() const override
     {
-      return (MatchTitle && Pred->Match(data.GetTitle())) || (MatchAuthor && Pred->Match(data.GetAuthor()))
-             || (MatchPath && Pred->Match(data.GetFullPath()));
+      return true;
     }
-
-  private:
-    const StringPredicate::Ptr Pred;
-    const bool MatchTitle;
-    const bool MatchAuthor;
-    const bool MatchPath;
   };
 
   class EmptyStringPredicate : public StringPredicate
@@ -147,9 +59,20 @@ namespace
   public:
     SimpleStringPredicate(QString pat, bool caseSensitive)
       : Pattern(std::move(pat))
+      , Substring(FromQString(Pattern))
       , Mode(caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive)
     {}
 
+    StringView GetSubstring() const override
+    {
+      return Substring;
+    }
+
+    bool IsCaseSensitive() const override
+    {
+      return Mode == Qt::CaseSensitive;
+    }
+
     bool Match(StringView str) const override
     {
       return ToQString(str).contains(Pattern, Mode);
@@ -157,6 +80,7 @@ namespace
 
   private:
     const QString Pattern;
+    const String Substring;
     const Qt::CaseSensitivity Mode;
   };
 
@@ -176,39 +100,131 @@ namespace
     const QRegExp Pattern;
   };
 
-  Predicate::Ptr CreatePredicate(const Playlist::Item::Search::Data& data)
+  StringPredicate::Ptr CreatePredicate(const Playlist::Item::Search::Data& data)
   {
     const QString& pattern = data.Pattern;
     if (0 == pattern.size())
     {
-      const StringPredicate::Ptr str = MakePtr<EmptyStringPredicate>();
-      return MakePtr<ScopePredicateDispatcher>(str, data.Scope);
+      return MakePtr<EmptyStringPredicate>();
     }
     const bool caseSensitive = 0 != (data.Options & Playlist::Item::Search::CASE_SENSITIVE);
     if (0 != (data.Options & Playlist::Item::Search::REGULAR_EXPRESSION))
     {
-      const StringPredicate::Ptr str = MakePtr<RegexStringPredicate>(pattern, caseSensitive);
-      return MakePtr<ScopePredicateDispatcher>(str, data.Scope);
+      return MakePtr<RegexStringPredicate>(pattern, caseSensitive);
     }
     else
     {
-      const StringPredicate::Ptr str = MakePtr<SimpleStringPredicate>(pattern, caseSensitive);
-      return MakePtr<ScopePredicateDispatcher>(str, data.Scope);
+      return MakePtr<SimpleStringPredicate>(pattern, caseSensitive);
     }
   }
+
+  class SearchOperation : public Playlist::Item::SelectionOperation
+  {
+  public:
+    SearchOperation(StringPredicate::Ptr pred, uint_t scope)
+      : SearchOperation({}, std::move(pred), scope)
+    {}
+
+    SearchOperation(Playlist::Model::IndexSet::Ptr items, StringPredicate::Ptr pred, uint_t scope)
+      : SelectedItems(std::move(items))
+      , Pred(std::move(pred))
+      , MatchTitle(0 != (scope & Playlist::Item::Search::TITLE))
+      , MatchAuthor(0 != (scope & Playlist::Item::Search::AUTHOR))
+      , MatchPath(0 != (scope & Playlist::Item::Search::PATH))
+    {
+      Require(Pred != nullptr);
+    }
+
+    void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
+    {
+      const auto& attributes = GetAttributes(stor, cb);
+      const auto rows = GetRows(attributes.Size());
+      auto result = MakeRWPtr<Playlist::Model::IndexSet>();
+      {
+        // each distinct string is matched once
+        const auto ids = GetUsedStrings(attributes, rows);
+        Log::NestedProgressCallback matching(2, 1, cb);
+        Log::PercentProgressCallback progress(static_cast<uint_t>(ids.size()), matching);
+        const auto matched = attributes.MatchStrings(ids, *Pred, progress);
+        const auto& titles = attributes.GetTitles();
+        const auto& authors = attributes.GetAuthors();
+        const auto& paths = attributes.GetPaths();
+        for (const auto row : rows)
+        {
+          if ((MatchTitle && matched[titles[row]]) || (MatchAuthor && matched[authors[row]])
+              || (MatchPath && matched[paths[row]]))
+          {
+            result->insert(static_cast<Playlist::Model::IndexType>(row));
+          }
+        }
+      }
+      emit ResultAcquired(std::move(result));
+    }
+
+  private:
+    // attributes are refreshed in the first half of progress
+    static const AttributesTable& GetAttributes(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb)
+    {
+      Log::NestedProgressCallback refreshing(2, 0, cb);
+      Log::PercentProgressCallback progress(static_cast<uint_t>(stor.CountItems()), refreshing);
+      return stor.GetAttributes(progress);
+    }
+
+    std::vector<std::size_t> GetRows(std::size_t total) const
+    {
+      if (SelectedItems)
+      {
+        return {SelectedItems->begin(), SelectedItems->end()};
+      }
+      std::vector<std::size_t> result(total);
+      std::iota(result.begin(), result.end(), 0);
+      return result;
+    }
+
+    std::vector<AttributesTable::StringId> GetUsedStrings(const AttributesTable& attributes,
+                                                          const std::vector<std::size_t>& rows) const
+    {
+      std::vector<AttributesTable::StringId> result;
+      for (const auto row : rows)
+      {
+        if (MatchTitle)
+        {
+          result.push_back(attributes.GetTitles()[row]);
+        }
+        if (MatchAuthor)
+        {
+          result.push_back(attributes.GetAuthors()[row]);
+        }
+        if (MatchPath)
+        {
+          result.push_back(attributes.GetPaths()[row]);
+        }
+      }
+      std::sort(result.begin(), result.end());
+      result.erase(std::unique(result.begin(), result.end()), result.end());
+      return result;
+    }
+
+  private:
+    const Playlist::Model::IndexSet::Ptr SelectedItems;
+    const StringPredicate::Ptr Pred;
+    const bool MatchTitle;
+    const bool MatchAuthor;
+    const bool MatchPath;
+  };
 }  // namespace
 
 namespace Playlist::Item
 {
   SelectionOperation::Ptr CreateSearchOperation(const Search::Data& data)
   {
-    const Predicate::Ptr pred = CreatePredicate(data);
-    return MakePtr<SearchOperation>(pred);
+    auto pred = CreatePredicate(data);
+    return MakePtr<SearchOperation>(std::move(pred), data.Scope);
   }
 
   SelectionOperation::Ptr CreateSearchOperation(Playlist::Model::IndexSet::Ptr items, const Search::Data& data)
   {
     auto pred = CreatePredicate(data);
-    return MakePtr<SearchOperation>(std::move(items), std::move(pred));
+    return MakePtr<SearchOperation>(std::move(items), std::move(pred), data.Scope);
   }
 }  // namespace Playlist::Item
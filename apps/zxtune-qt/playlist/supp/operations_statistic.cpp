@@ -13,6 +13,8 @@
 #include "apps/zxtune-qt/playlist/supp/operations_helpers.h"
 #include "apps/zxtune-qt/playlist/supp/storage.h"
 
+#include "tools/progress_callback_helpers.h"
+
 #include "make_ptr.h"
 
 namespace
@@ -35,32 +37,41 @@ namespace
 
     void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
     {
-      ExecuteOperation(stor, SelectedItems, *this, cb);
+      {
+        // attributes are refreshed in the first half of progress
+        Log::NestedProgressCallback refreshing(2, 0, cb);
+        Log::PercentProgressCallback progress(static_cast<uint_t>(stor.CountItems()), refreshing);
+        Attributes = &stor.GetAttributes(progress);
+      }
+      Log::NestedProgressCallback visiting(2, 1, cb);
+      ExecuteOperation(stor, SelectedItems, *this, visiting);
+      Attributes = nullptr;
       emit ResultAcquired(Result);
     }
 
   private:
-    void OnItem(Playlist::Model::IndexType /*index*/, Playlist::Item::Data::Ptr data) override
+    void OnItem(Playlist::Model::IndexType index, Playlist::Item::Data::Ptr data) override
     {
       data->GetModule();
       // check for the data first to define is data valid or not
-      const String type = data->GetType();
       if (data->GetState().GetIfError())
       {
         Result->AddInvalid();
       }
       else
       {
+        const auto type = Attributes->GetString(Attributes->GetTypes()[index]);
         assert(!type.empty());
         Result->AddValid();
         Result->AddType(type);
-        Result->AddDuration(data->GetDuration());
-        Result->AddSize(data->GetSize());
+        Result->AddDuration(Attributes->GetDurations()[index]);
+        Result->AddSize(Attributes->GetSizes()[index]);
         Result->AddPath(data->GetFilePath());
       }
     }
 
   private:
+    const Playlist::Item::AttributesTable* Attributes = nullptr;
     const Playlist::Model::IndexSet::Ptr SelectedItems;
     const Playlist::Item::StatisticTextNotification::Ptr Result;
   };
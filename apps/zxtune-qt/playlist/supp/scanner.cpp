@@ -11,6 +11,8 @@
 #include "apps/zxtune-qt/playlist/supp/scanner.h"
 
 #include "apps/zxtune-qt/playlist/io/import.h"
+#include "apps/zxtune-qt/playlist/parameters.h"
+#include "apps/zxtune-qt/supp/options.h"
 #include "apps/zxtune-qt/ui/utils.h"
 
 #include "async/coroutine.h"
@@ -25,9 +27,17 @@
 #include <QtCore/QDirIterator>
 #include <QtCore/QStringList>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -344,6 +354,252 @@ namespace
     Time::Elapsed ReportTimeout;
   };
 
+  // Accumulates single file scanning results to pass them later
+  class DeferredCallback : public ScannerCallback
+  {
+  public:
+    using Ptr = std::unique_ptr<DeferredCallback>;
+
+    void OnItem(Playlist::Item::Data::Ptr item) override
+    {
+      Events.emplace_back([item = std::move(item)](ScannerCallback& cb) { cb.OnItem(item); });
+    }
+
+    void OnItems(Playlist::Item::Collection::Ptr items) override
+    {
+      Events.emplace_back([items = std::move(items)](ScannerCallback& cb) { cb.OnItems(items); });
+    }
+
+    void OnError(const class Error& err) override
+    {
+      Events.emplace_back([err](ScannerCallback& cb) { cb.OnError(err); });
+    }
+
+    // progress is reported by workers directly, scan start/end are reported by routine
+    void OnScanStart(Playlist::ScanStatus::Ptr /*status*/) override {}
+    void OnProgress(unsigned /*progress*/) override {}
+    void OnMessage(const QString& /*message*/) override {}
+    void OnScanEnd() override {}
+
+    void Flush(ScannerCallback& target)
+    {
+      for (const auto& evt : Events)
+      {
+        evt(target);
+      }
+    }
+
+  private:
+    std::vector<std::function<void(ScannerCallback&)>> Events;
+  };
+
+  struct ScanCancelled
+  {};
+
+  using ScanFunction = std::function<void(const QString&, ScannerCallback&, Log::ProgressCallback&)>;
+
+  // Passes progress of the simultaneously scanned files not often than UI notification period
+  class SharedProgressTarget
+  {
+  public:
+    explicit SharedProgressTarget(ScannerCallback& cb)
+      : Callback(cb)
+      , ReportTimeout(UI_NOTIFICATION_PERIOD)
+    {}
+
+    void OnProgress(uint_t current)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (ReportTimeout())
+      {
+        Callback.OnProgress(current);
+      }
+    }
+
+    void OnProgress(uint_t current, StringView message)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (ReportTimeout())
+      {
+        Callback.OnProgress(current);
+        Callback.OnMessage(ToQString(message));
+      }
+    }
+
+  private:
+    ScannerCallback& Callback;
+    std::mutex Guard;
+    Time::Elapsed ReportTimeout;
+  };
+
+  class WorkerProgressAdapter : public Log::ProgressCallback
+  {
+  public:
+    WorkerProgressAdapter(SharedProgressTarget& target, Async::Scheduler& sched)
+      : Target(target)
+      , Scheduler(sched)
+    {}
+
+    void OnProgress(uint_t current) override
+    {
+      Target.OnProgress(current);
+      Scheduler.Yield();
+    }
+
+    void OnProgress(uint_t current, StringView message) override
+    {
+      Target.OnProgress(current, message);
+      Scheduler.Yield();
+    }
+
+  private:
+    SharedProgressTarget& Target;
+    Async::Scheduler& Scheduler;
+  };
+
+  // Scans files from the source on several threads, results are passed in the order of source
+  class ParallelScan : private Async::Scheduler
+  {
+  public:
+    ParallelScan(FilenamesSource& source, ScanFunction scan, ScannerCallback& progress, uint_t threads)
+      : Source(source)
+      , Scan(std::move(scan))
+      , Progress(progress)
+      , MaxAhead(4 * threads)
+      , ActiveWorkers(threads)
+    {
+      Workers.reserve(threads);
+      for (uint_t idx = 0; idx != threads; ++idx)
+      {
+        Workers.emplace_back(&ParallelScan::WorkProc, this);
+      }
+    }
+
+    ~ParallelScan() override
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Cancelled = true;
+      }
+      Changed.notify_all();
+      for (auto& worker : Workers)
+      {
+        worker.join();
+      }
+    }
+
+    void Pause(bool pause)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Paused = pause;
+      }
+      Changed.notify_all();
+    }
+
+    //! @brief Passes all the ready results to target waiting for them up to timeout
+    //! @return false if all the files are scanned and passed
+    bool Flush(ScannerCallback& target, Time::Milliseconds timeout)
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      Changed.wait_for(lock, std::chrono::milliseconds(timeout.Get()),
+                       [this]() { return Results.count(Passed) != 0 || IsFinished(); });
+      for (auto it = Results.find(Passed); it != Results.end(); it = Results.find(++Passed))
+      {
+        const auto result = std::move(it->second);
+        Results.erase(it);
+        lock.unlock();
+        Changed.notify_all();
+        result->Flush(target);
+        lock.lock();
+      }
+      return !IsFinished();
+    }
+
+  private:
+    bool IsFinished() const
+    {
+      return ActiveWorkers == 0 && Passed == Taken;
+    }
+
+    void WorkProc()
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      for (;;)
+      {
+        Changed.wait(lock, [this]() { return Cancelled || (!Paused && Taken < Passed + MaxAhead); });
+        if (Cancelled || Source.Empty())
+        {
+          break;
+        }
+        const auto idx = Taken++;
+        auto result = std::make_unique<DeferredCallback>();
+        try
+        {
+          const auto file = Source.GetNext();
+          lock.unlock();
+          WorkerProgressAdapter progress(Progress, *this);
+          Scan(file, *result, progress);
+        }
+        catch (const ScanCancelled&)
+        {
+          lock.lock();
+          break;
+        }
+        catch (const std::exception&)
+        {}
+        if (!lock.owns_lock())
+        {
+          lock.lock();
+        }
+        Results.emplace(idx, std::move(result));
+        Changed.notify_all();
+      }
+      --ActiveWorkers;
+      Changed.notify_all();
+    }
+
+    // called from workers
+    void Yield() override
+    {
+      if (Cancelled)
+      {
+        throw ScanCancelled();
+      }
+      if (Paused)
+      {
+        std::unique_lock<std::mutex> lock(Guard);
+        Changed.wait(lock, [this]() { return Cancelled || !Paused; });
+        if (Cancelled)
+        {
+          throw ScanCancelled();
+        }
+      }
+    }
+
+  private:
+    FilenamesSource& Source;
+    const ScanFunction Scan;
+    SharedProgressTarget Progress;
+    const std::size_t MaxAhead;
+    std::mutex Guard;
+    std::condition_variable Changed;
+    std::atomic<bool> Cancelled = false;
+    std::atomic<bool> Paused = false;
+    std::size_t Taken = 0;
+    std::size_t Passed = 0;
+    uint_t ActiveWorkers;
+    std::map<std::size_t, DeferredCallback::Ptr> Results;
+    std::vector<std::thread> Workers;
+  };
+
+  uint_t GetScanThreads()
+  {
+    using namespace Parameters::ZXTuneQT::Playlist::Scan;
+    const auto threads = Parameters::GetInteger<uint_t>(*GlobalOptions::Instance().Get(), THREADS, THREADS_DEFAULT);
+    return threads != 0 ? threads : std::max<uint_t>(1, std::thread::hardware_concurrency());
+  }
+
   class ScanRoutine
     : public FilenamesTarget
     , public Async::Coroutine
@@ -370,23 +626,44 @@ namespace
 
     void Finalize() override
     {
+      // stop workers before reporting
+      Workers.reset();
       Callback.OnScanEnd();
       CreateQueue();
     }
 
-    void Suspend() override {}
+    void Suspend() override
+    {
+      if (Workers)
+      {
+        Workers->Pause(true);
+      }
+    }
 
-    void Resume() override {}
+    void Resume() override
+    {
+      if (Workers)
+      {
+        Workers->Pause(false);
+      }
+    }
 
     void Execute(Async::Scheduler& sched) override
     {
+      const auto threads = GetScanThreads();
+      Dbg("Scan using {} threads", threads);
+      if (threads > 1)
+      {
+        ExecuteParallel(sched, threads);
+        return;
+      }
       ProgressCallbackAdapter cb(Callback, sched);
       while (!Queue->Empty())
       {
         try
         {
           const QString file = Queue->GetNext();
-          ScanFile(file, cb);
+          ScanFile(file, Callback, cb);
         }
         catch (const std::exception&)
         {}
@@ -399,15 +676,34 @@ namespace
       Queue = MakePtr<FilesQueue>();
     }
 
-    void ScanFile(const QString& name, Log::ProgressCallback& cb)
+    void ExecuteParallel(Async::Scheduler& sched, uint_t threads)
+    {
+      // files may be added while finishing previous pass
+      while (!Queue->Empty())
+      {
+        Workers = std::make_unique<ParallelScan>(
+            *Queue,
+            [this](const QString& file, ScannerCallback& target, Log::ProgressCallback& cb) {
+              ScanFile(file, target, cb);
+            },
+            Callback, threads);
+        while (Workers->Flush(Callback, UI_NOTIFICATION_PERIOD))
+        {
+          sched.Yield();
+        }
+        Workers.reset();
+      }
+    }
+
+    void ScanFile(const QString& name, ScannerCallback& target, Log::ProgressCallback& cb) const
     {
-      if (!ProcessAsPlaylist(name, cb))
+      if (!ProcessAsPlaylist(name, target, cb))
       {
-        DetectSubitems(name, cb);
+        DetectSubitems(name, target, cb);
       }
     }
 
-    bool ProcessAsPlaylist(const QString& path, Log::ProgressCallback& cb)
+    bool ProcessAsPlaylist(const QString& path, ScannerCallback& target, Log::ProgressCallback& cb) const
     {
       try
       {
@@ -416,25 +712,25 @@ namespace
         {
           return false;
         }
-        Callback.OnItems(playlist->GetItems());
+        target.OnItems(playlist->GetItems());
       }
       catch (const Error& e)
       {
-        Callback.OnError(e);
+        target.OnError(e);
       }
       return true;
     }
 
-    void DetectSubitems(const QString& itemPath, Log::ProgressCallback& cb)
+    void DetectSubitems(const QString& itemPath, ScannerCallback& target, Log::ProgressCallback& cb) const
     {
       try
       {
-        DetectParamsAdapter params(Callback, cb);
+        DetectParamsAdapter params(target, cb);
         Provider->DetectModules(FromQString(itemPath), params);
       }
       catch (const Error& e)
       {
-        Callback.OnError(e);
+        target.OnError(e);
       }
     }
 
@@ -442,6 +738,7 @@ namespace
     ScannerCallback& Callback;
     const Playlist::Item::DataProvider::Ptr Provider;
     FilesQueue::Ptr Queue;
+    std::unique_ptr<ParallelScan> Workers;
   };
 
   class ScannerImpl
@@ -453,7 +750,7 @@ namespace
       : Playlist::Scanner(parent)
       , Provider(provider)
       , Routine(MakePtr<ScanRoutine>(static_cast<ScannerCallback&>(*this), std::move(provider)))
-      , ScanJob(Async::CreateJob(Routine))
+      , ScanJob(Async::CreateJob(Async::Priority::BACKGROUND, Routine))
     {
       Dbg("Created at {}", Self());
     }
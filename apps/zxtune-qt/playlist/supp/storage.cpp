@@ -12,11 +12,15 @@
 
 #include "debug/log.h"
 #include "math/numeric.h"
+#include "tools/progress_callback.h"
 
 #include "make_ptr.h"
 
+#include <algorithm>
+#include <numeric>
 #include <random>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -157,6 +161,34 @@ namespace
 
   const std::size_t CACHE_THRESHOLD = 200;
 
+  std::vector<std::size_t> GetRemainingRows(std::size_t total, const Model::IndexSet& removed)
+  {
+    std::vector<std::size_t> result;
+    result.reserve(total - removed.size());
+    auto it = removed.begin();
+    const auto lim = removed.end();
+    for (std::size_t row = 0; row != total; ++row)
+    {
+      if (it != lim && *it == row)
+      {
+        ++it;
+      }
+      else
+      {
+        result.push_back(row);
+      }
+    }
+    return result;
+  }
+
+  std::vector<std::size_t> GetMovedRows(std::size_t total, const Model::IndexSet& moved, Model::IndexType destination)
+  {
+    auto result = GetRemainingRows(total, moved);
+    const auto pos = std::lower_bound(result.begin(), result.end(), destination);
+    result.insert(pos, moved.begin(), moved.end());
+    return result;
+  }
+
   class LinearStorage : public Item::Storage
   {
   public:
@@ -167,6 +199,7 @@ namespace
 
     LinearStorage(const LinearStorage& rh)
       : Items(rh.Items)
+      , Attributes(rh.Attributes)
     {
       Dbg("Created at {} (cloned from {} with {} items)", Self(), rh.Self(), Items.size());
     }
@@ -204,16 +237,19 @@ namespace
     {
       const IndexedItem idxItem(item, static_cast<Model::IndexType>(Items.size()));
       Items.push_back(idxItem);
+      Attributes.Append(1);
       Modify();
     }
 
     void Add(Item::Collection::Ptr items) override
     {
-      for (auto idx = static_cast<Model::IndexType>(Items.size()); items->IsValid(); items->Next(), ++idx)
+      const auto prevSize = Items.size();
+      for (auto idx = static_cast<Model::IndexType>(prevSize); items->IsValid(); items->Next(), ++idx)
       {
         const IndexedItem idxItem(items->Get(), idx);
         Items.push_back(idxItem);
       }
+      Attributes.Append(Items.size() - prevSize);
       Modify();
     }
 
@@ -251,6 +287,25 @@ namespace
       ForChoosenItems(indices, walker);
     }
 
+    const Item::AttributesTable& GetAttributes(Log::ProgressCallback& cb) const override
+    {
+      uint_t done = 0;
+      std::size_t refreshed = 0;
+      for (const auto& item : Items)
+      {
+        if (Attributes.Refresh(done, *item.first))
+        {
+          ++refreshed;
+        }
+        cb.OnProgress(++done);
+      }
+      if (refreshed)
+      {
+        Dbg("Refreshed attributes of {} items out of {}", refreshed, done);
+      }
+      return Attributes;
+    }
+
     void MoveItems(const Model::IndexSet& indices, Model::IndexType destination) override
     {
       if (!indices.count(destination))
@@ -274,28 +329,27 @@ namespace
 
     void Sort(const Item::Comparer& cmp) override
     {
-      Items.sort(ComparerWrapper(cmp));
-      ClearCache();
-      Modify();
+      const auto iters = GetIterators();
+      std::vector<std::size_t> rows(iters.size());
+      std::iota(rows.begin(), rows.end(), 0);
+      std::stable_sort(rows.begin(), rows.end(), [&iters, &cmp](std::size_t lh, std::size_t rh) {
+        return cmp.CompareItems(*iters[lh]->first, *iters[rh]->first);
+      });
+      Reorder(iters, rows);
+    }
+
+    void Sort(Item::AttributesTable::Column column, bool ascending) override
+    {
+      GetAttributes(Log::ProgressCallback::Stub());
+      Reorder(GetIterators(), Attributes.GetSortedRows(column, ascending));
     }
 
     void Shuffle() override
     {
-      std::vector<ItemsContainer::const_iterator> iters;
-      iters.reserve(Items.size());
-      for (auto it = Items.begin(), lim = Items.end(); it != lim; ++it)
-      {
-        iters.emplace_back(it);
-      }
-      std::shuffle(iters.begin(), iters.end(), std::mt19937(std::random_device()()));
-      ItemsContainer newOne;
-      for (const auto& it : iters)
-      {
-        newOne.push_back(*it);
-      }
-      newOne.swap(Items);
-      ClearCache();
-      Modify();
+      std::vector<std::size_t> rows(Items.size());
+      std::iota(rows.begin(), rows.end(), 0);
+      std::shuffle(rows.begin(), rows.end(), std::mt19937(std::random_device()()));
+      Reorder(GetIterators(), rows);
     }
 
     void RemoveItems(const Model::IndexSet& indices) override
@@ -304,10 +358,12 @@ namespace
       {
         return;
       }
+      const auto rows = GetRemainingRows(Items.size(), indices);
       {
         RemoveItemsWalker walker(Items);
         ForChoosenItems(indices, walker);
       }
+      Attributes.Reorder(rows);
       ClearCache();
       Modify();
     }
@@ -318,21 +374,30 @@ namespace
       return this;
     }
 
-    class ComparerWrapper
+    std::vector<ItemsContainer::iterator> GetIterators() const
     {
-    public:
-      explicit ComparerWrapper(const Item::Comparer& cmp)
-        : Cmp(cmp)
-      {}
-
-      bool operator()(const ItemsContainer::value_type& lh, const ItemsContainer::value_type& rh) const
+      std::vector<ItemsContainer::iterator> result;
+      result.reserve(Items.size());
+      for (auto it = Items.begin(), lim = Items.end(); it != lim; ++it)
       {
-        return Cmp.CompareItems(*lh.first, *rh.first);
+        result.push_back(it);
       }
+      return result;
+    }
 
-    private:
-      const Item::Comparer& Cmp;
-    };
+    // items and attributes are placed in specified rows order
+    void Reorder(const std::vector<ItemsContainer::iterator>& iters, const std::vector<std::size_t>& rows)
+    {
+      ItemsContainer newOne;
+      for (const auto row : rows)
+      {
+        newOne.splice(newOne.end(), Items, iters[row]);
+      }
+      newOne.swap(Items);
+      Attributes.Reorder(rows);
+      ClearCache();
+      Modify();
+    }
 
     using IndexToIterator = std::map<Model::IndexType, ItemsContainer::iterator>;
 
@@ -412,6 +477,7 @@ namespace
         return;
       }
       assert(!indices.count(destination));
+      const auto rows = GetMovedRows(Items.size(), indices, destination);
       auto delimiter = GetIteratorByIndex(destination);
 
       ItemsContainer movedItems;
@@ -427,6 +493,7 @@ namespace
       // gathering back
       Items.splice(Items.end(), movedItems);
       Items.splice(Items.end(), afterItems);
+      Attributes.Reorder(rows);
       ClearCache();
       Modify();
     }
@@ -483,6 +550,8 @@ namespace
     unsigned Version = 0;
     mutable ItemsContainer Items;
     mutable IndexToIterator IteratorsCache;
+    // refreshed on demand, operations are not performed concurrently
+    mutable Item::AttributesTable Attributes;
   };
 }  // namespace
 
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "apps/zxtune-qt/playlist/supp/attributes_table.h"
 #include "apps/zxtune-qt/playlist/supp/model.h"
 
 namespace Playlist::Item
@@ -53,9 +54,12 @@ namespace Playlist::Item
 
     virtual void ForAllItems(Visitor& visitor) const = 0;
     virtual void ForSpecifiedItems(const Model::IndexSet& indices, Visitor& visitor) const = 0;
+    //! Rows are in items order, changed items are refreshed with progress reported in items
+    virtual const AttributesTable& GetAttributes(Log::ProgressCallback& cb) const = 0;
     // update
     virtual void MoveItems(const Model::IndexSet& indices, Model::IndexType destination) = 0;
     virtual void Sort(const Comparer& cmp) = 0;
+    virtual void Sort(AttributesTable::Column column, bool ascending) = 0;
     virtual void Shuffle() = 0;
     // delete
     virtual void RemoveItems(const Model::IndexSet& indices) = 0;
@@ -0,0 +1,337 @@
+/**
+ *
+ * @file
+ *
+ * @brief Playlist items attributes table test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "apps/zxtune-qt/playlist/supp/attributes_table.h"
+
+#include "strings/format.h"
+
+#include "error.h"
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+  using namespace Playlist::Item;
+
+  class FakeData : public Data
+  {
+  public:
+    FakeData(String title, String author, String path)
+      : Title(std::move(title))
+      , Author(std::move(author))
+      , Path(std::move(path))
+      , Properties(Parameters::Container::Create())
+    {}
+
+    Module::Holder::Ptr GetModule() const override
+    {
+      return {};
+    }
+
+    Binary::Data::Ptr GetModuleData() const override
+    {
+      return {};
+    }
+
+    Parameters::Accessor::Ptr GetModuleProperties() const override
+    {
+      return Properties;
+    }
+
+    Parameters::Container::Ptr GetAdjustedParameters() const override
+    {
+      return Properties;
+    }
+
+    Capabilities GetCapabilities() const override
+    {
+      return Capabilities(0);
+    }
+
+    ModuleState GetState() const override
+    {
+      throw std::logic_error("Should not be called");
+    }
+
+    String GetFullPath() const override
+    {
+      return Path;
+    }
+
+    String GetFilePath() const override
+    {
+      return Path;
+    }
+
+    String GetType() const override
+    {
+      return "PT3";
+    }
+
+    String GetDisplayName() const override
+    {
+      return Title;
+    }
+
+    Time::Milliseconds GetDuration() const override
+    {
+      return Time::Milliseconds(Title.size());
+    }
+
+    String GetAuthor() const override
+    {
+      return Author;
+    }
+
+    String GetTitle() const override
+    {
+      return Title;
+    }
+
+    String GetComment() const override
+    {
+      return {};
+    }
+
+    uint32_t GetChecksum() const override
+    {
+      return 0;
+    }
+
+    uint32_t GetCoreChecksum() const override
+    {
+      return 0;
+    }
+
+    std::size_t GetSize() const override
+    {
+      return Path.size();
+    }
+
+    void SetTitle(String title)
+    {
+      Title = std::move(title);
+      Properties->SetValue("title", Title);
+    }
+
+  private:
+    String Title;
+    const String Author;
+    const String Path;
+    const Parameters::Container::Ptr Properties;
+  };
+
+  class SubstringMatcher : public AttributesTable::StringsMatcher
+  {
+  public:
+    SubstringMatcher(String substring, bool caseSensitive, bool plain)
+      : Substring(std::move(substring))
+      , CaseSensitive(caseSensitive)
+      , Plain(plain)
+    {}
+
+    StringView GetSubstring() const override
+    {
+      return Plain ? StringView(Substring) : StringView();
+    }
+
+    bool IsCaseSensitive() const override
+    {
+      return CaseSensitive;
+    }
+
+    bool Match(StringView str) const override
+    {
+      return CaseSensitive ? str.find(Substring) != str.npos : Fold(str).find(Fold(Substring)) != String::npos;
+    }
+
+  private:
+    static String Fold(StringView str)
+    {
+      String result(str);
+      std::transform(result.begin(), result.end(), result.begin(),
+                     [](char sym) { return sym >= 'A' && sym <= 'Z' ? sym + ('a' - 'A') : sym; });
+      return result;
+    }
+
+  private:
+    const String Substring;
+    const bool CaseSensitive;
+    const bool Plain;
+  };
+
+  void Test(bool res, StringView text)
+  {
+    std::cout << (res ? "Passed" : "Failed") << " test '" << text << "'" << std::endl;
+    if (!res)
+    {
+      throw Error(THIS_LINE, "Test failed");
+    }
+  }
+
+  String MakeWord(uint_t seed)
+  {
+    static const StringView PARTS[] = {"ab", "Ba", "cd", "x", "yZ", "Music", "\xd0\x9f\xd1\x80", "tune", " ", "q"};
+    String result;
+    for (uint_t idx = 0, lim = 1 + seed % 5; idx != lim; ++idx)
+    {
+      seed = seed * 1103515245 + 12345;
+      result += PARTS[(seed >> 16) % std::size(PARTS)];
+    }
+    return result;
+  }
+
+  class Fixture
+  {
+  public:
+    explicit Fixture(uint_t count)
+    {
+      for (uint_t idx = 0; idx != count; ++idx)
+      {
+        Items.push_back(std::make_shared<FakeData>(MakeWord(idx), MakeWord(idx * 7 + 1),
+                                           Strings::Format("/music/{}/{}.pt3", MakeWord(idx * 3 + 2), idx)));
+      }
+      Table.Append(count);
+      Refresh();
+    }
+
+    void Refresh()
+    {
+      for (std::size_t row = 0; row != Items.size(); ++row)
+      {
+        Table.Refresh(row, *Items[row]);
+      }
+    }
+
+    void Reorder(const std::vector<std::size_t>& rows)
+    {
+      std::vector<std::shared_ptr<FakeData>> items;
+      for (const auto row : rows)
+      {
+        items.push_back(Items[row]);
+      }
+      Items.swap(items);
+      Table.Reorder(rows);
+    }
+
+    bool IsConsistent(const AttributesTable& table) const
+    {
+      for (std::size_t row = 0; row != Items.size(); ++row)
+      {
+        const auto& item = *Items[row];
+        if (table.GetString(table.GetTitles()[row]) != item.GetTitle()
+            || table.GetString(table.GetAuthors()[row]) != item.GetAuthor()
+            || table.GetString(table.GetPaths()[row]) != item.GetFullPath()
+            || table.GetString(table.GetTypes()[row]) != item.GetType()
+            || table.GetSizes()[row] != item.GetSize())
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::vector<std::shared_ptr<FakeData>> Items;
+    AttributesTable Table;
+  };
+
+  void TestSort()
+  {
+    Fixture fixture(1000);
+    for (const auto ascending : {true, false})
+    {
+      const auto rows = fixture.Table.GetSortedRows(AttributesTable::Column::TITLE, ascending);
+      std::vector<std::size_t> reference(fixture.Items.size());
+      std::iota(reference.begin(), reference.end(), 0);
+      const auto& items = fixture.Items;
+      std::stable_sort(reference.begin(), reference.end(), [&items, ascending](std::size_t lh, std::size_t rh) {
+        return ascending ? items[lh]->GetTitle() < items[rh]->GetTitle()
+                         : items[rh]->GetTitle() < items[lh]->GetTitle();
+      });
+      Test(rows == reference, ascending ? "Sort by title ascending" : "Sort by title descending");
+    }
+    fixture.Reorder(fixture.Table.GetSortedRows(AttributesTable::Column::PATH, true));
+    Test(fixture.IsConsistent(fixture.Table), "Reorder by path");
+    fixture.Items.front()->SetTitle("Changed");
+    fixture.Refresh();
+    Test(fixture.IsConsistent(fixture.Table), "Refresh changed");
+  }
+
+  void TestRemove()
+  {
+    Fixture fixture(10000);
+    const auto copy = fixture.Table;
+    std::vector<std::size_t> rows;
+    for (std::size_t row = 0; row < fixture.Items.size(); row += 10)
+    {
+      rows.push_back(row);
+    }
+    auto removed = fixture;
+    removed.Reorder(rows);
+    Test(removed.IsConsistent(removed.Table), "Remove most of rows");
+    Test(fixture.IsConsistent(copy), "Copy after removal");
+    removed.Items.push_back(std::make_shared<FakeData>("New", "Author", "/new.pt3"));
+    removed.Table.Append(1);
+    removed.Refresh();
+    Test(removed.IsConsistent(removed.Table), "Add after removal");
+  }
+
+  void TestMatch()
+  {
+    Fixture fixture(5000);
+    const auto& table = fixture.Table;
+    std::vector<AttributesTable::StringId> ids;
+    for (const auto* column : {&table.GetTitles(), &table.GetAuthors(), &table.GetPaths()})
+    {
+      ids.insert(ids.end(), column->begin(), column->end());
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    // extended queries reuse previous results
+    const StringView queries[] = {"a", "ab", "abc", "Ba", "BaB", "Mu", "Music", "usic", "\xd0\x9f", "yz", "yZt", "/"};
+    for (const auto caseSensitive : {true, false})
+    {
+      for (const auto plain : {true, false})
+      {
+        bool matched = true;
+        for (const auto query : queries)
+        {
+          const SubstringMatcher matcher(String(query), caseSensitive, plain);
+          const auto result = table.MatchStrings(ids, matcher, Log::ProgressCallback::Stub());
+          for (const auto id : ids)
+          {
+            matched = matched && result[id] == matcher.Match(table.GetString(id));
+          }
+        }
+        Test(matched, Strings::Format("Match strings (case sensitive={}, plain={})", caseSensitive, plain));
+      }
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestSort();
+    TestRemove();
+    TestMatch();
+    return 0;
+  }
+  catch (const Error& e)
+  {
+    std::cout << e.ToString() << std::endl;
+    return 1;
+  }
+}
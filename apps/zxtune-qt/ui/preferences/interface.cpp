@@ -92,6 +92,8 @@ namespace
                          ZXTuneQT::Playlist::Cache::FILES_LIMIT_DEFAULT);
       IntegerValue::Bind(*playlistCacheLimit, *Options, ZXTuneQT::Playlist::Cache::MEMORY_LIMIT_MB,
                          ZXTuneQT::Playlist::Cache::MEMORY_LIMIT_MB_DEFAULT);
+      IntegerValue::Bind(*playlistScanThreads, *Options, ZXTuneQT::Playlist::Scan::THREADS,
+                         ZXTuneQT::Playlist::Scan::THREADS_DEFAULT);
       BooleanValue::Bind(*playlistStoreAllProperties, *Options, ZXTuneQT::Playlist::Store::PROPERTIES,
                          ZXTuneQT::Playlist::Store::PROPERTIES_DEFAULT);
       UpdateCheckPeriod = IntegerValue::Bind(*updateCheckPeriod, MakePtr<UpdateCheckPeriodComboboxValue>(Options));
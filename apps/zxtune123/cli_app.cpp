@@ -25,6 +25,7 @@
 #include "core/core_parameters.h"
 #include "core/plugin.h"
 #include "core/plugin_attrs.h"
+#include "debug/metrics.h"
 #include "io/api.h"
 #include "io/template.h"
 #include "module/attributes.h"
@@ -44,6 +45,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <fstream>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -246,12 +248,24 @@ namespace
   class Benchmark : public OnItemCallback
   {
   public:
-    Benchmark(unsigned iterations, bool dumpUnknownData, SoundComponent& sound, DisplayComponent& display)
-      : Iterations(iterations)
+    Benchmark(Parameters::Accessor::Ptr params, unsigned iterations, bool dumpUnknownData, const String& reportFile,
+              SoundComponent& sound, DisplayComponent& display)
+      : Params(std::move(params))
+      , Iterations(iterations)
       , DumpUnknownData(dumpUnknownData)
       , Sounder(sound)
       , Display(display)
-    {}
+    {
+      if (!reportFile.empty())
+      {
+        Report.open(reportFile, std::ios::out | std::ios::trunc);
+        if (!Report)
+        {
+          throw Error(THIS_LINE, "Failed to create benchmark report file " + reportFile);
+        }
+        Report << "path,type,detect_ms,speed,seek_ms,crc\n";
+      }
+    }
 
     void ProcessItem(Binary::Data::Ptr /*data*/, Module::Holder::Ptr holder) override
     {
@@ -260,11 +274,14 @@ namespace
       const auto& path = Parameters::GetString(*props, Module::ATTR_FULLPATH);
       const auto& type = Parameters::GetString(*props, Module::ATTR_TYPE);
 
+      // time spent since previous item processing, i.e. opening, detection and other subtunes search
+      const auto detectTime = DetectTimer.Elapsed<Time::Microsecond>();
       try
       {
         const auto total = info->Duration() * Iterations;
         BenchmarkSoundReceiver receiver;
-        const auto renderer = holder->CreateRenderer(Sounder.GetSamplerate(), props);
+        const auto renderer =
+            holder->CreateRenderer(Sounder.GetSamplerate(), Parameters::CreateMergedAccessor(props, Params));
         const auto state = renderer->GetState();
         const Time::Timer timer;
         for (unsigned i = 0; i != Iterations; ++i)
@@ -288,6 +305,13 @@ namespace
         Display.Message("x{2:.2f}\t({1})\t{0}\t[0x{3:08x}]\t{{{4}..{5}, {6}}}", path, type, relSpeed,
                         receiver.GetHash(), receiver.GetMinSample(), receiver.GetMaxSample(),
                         receiver.GetTotalSamples());
+        if (Report.is_open())
+        {
+          const auto seekTime = MeasureSeek(*renderer, info->Duration());
+          Report << Strings::Format("\"{}\",{},{:.3f},{:.2f},{:.3f},{:08x}\n", path, type, ToMs(detectTime), relSpeed,
+                                    ToMs(seekTime), receiver.GetHash());
+          Report.flush();
+        }
       }
       catch (const std::exception& e)
       {
@@ -301,6 +325,7 @@ namespace
       {
         BenchmarkFail(path, type, "Unknown error");
       }
+      DetectTimer = {};
     }
 
     void ProcessUnknownData(StringView path, StringView container, Binary::Data::Ptr data) override
@@ -317,6 +342,23 @@ namespace
       Display.Message("Fail\t({1})\t{0}\t[{2}]", path, type, msg);
     }
 
+    // average time of seeking to quarters of module
+    static Time::Microseconds MeasureSeek(Module::Renderer& renderer, Time::Milliseconds duration)
+    {
+      const uint_t SEEKS[] = {1, 2, 3};
+      const Time::Timer timer;
+      for (const auto quarter : SEEKS)
+      {
+        renderer.SetPosition(Time::AtMillisecond(duration.Get() * quarter / 4));
+      }
+      return Time::Microseconds(timer.Elapsed<Time::Microsecond>().Get() / std::size(SEEKS));
+    }
+
+    static double ToMs(Time::Microseconds val)
+    {
+      return double(val.Get()) / 1000;
+    }
+
     class BenchmarkSoundReceiver
     {
     public:
@@ -366,14 +408,38 @@ namespace
     };
 
   private:
+    const Parameters::Accessor::Ptr Params;
     const unsigned Iterations;
     const bool DumpUnknownData;
     SoundComponent& Sounder;
     DisplayComponent& Display;
+    std::ofstream Report;
+    Time::Timer DetectTimer;
   };
 
   const auto NO_BENCHMARK = ~0u;
 
+  // finishes trace and outputs metrics regardless of processing result
+  class MetricsOutput
+  {
+  public:
+    explicit MetricsOutput(bool dump)
+      : Dump(dump)
+    {}
+
+    ~MetricsOutput()
+    {
+      Metrics::StopTrace();
+      if (Dump)
+      {
+        StdOut << Metrics::MakeReport() << std::flush;
+      }
+    }
+
+  private:
+    const bool Dump;
+  };
+
   class CLIApplication
     : public Platform::Application
     , private OnItemCallback
@@ -399,6 +465,12 @@ namespace
 
         Sourcer->Initialize();
 
+        if (!TraceFile.empty() && !Metrics::StartTrace(TraceFile))
+        {
+          throw MakeFormattedError(THIS_LINE, "Failed to create trace file '{}'.", TraceFile);
+        }
+        const MetricsOutput metrics(DumpMetrics);
+
         if (!ConvertParams.empty())
         {
           const Parameters::Container::Ptr cnvParams = Parameters::Container::Create();
@@ -409,7 +481,7 @@ namespace
         }
         else if (NO_BENCHMARK != BenchmarkIterations)
         {
-          Benchmark benchmark(BenchmarkIterations, DumpUnknownData, *Sounder, *Display);
+          Benchmark benchmark(ConfigParams, BenchmarkIterations, DumpUnknownData, BenchmarkReport, *Sounder, *Display);
           Sourcer->ProcessItems(benchmark);
         }
         else
@@ -452,7 +524,12 @@ namespace
               ".");
           opt("benchmark", value<uint_t>(&BenchmarkIterations),
               "Switch on benchmark mode with specified iterations count.\n");
+          opt("benchmark-report", value<String>(&BenchmarkReport),
+              "Also store benchmark results to specified file in csv format.\n");
           opt("dump-unknown-data", bool_switch(&DumpUnknownData), "Also report about unprocessed data regions.\n");
+          opt("metrics", bool_switch(&DumpMetrics), "Output collected performance metrics at exit.\n");
+          opt("trace", value<String>(&TraceFile),
+              "Store timings to specified file in Chrome trace event format.\n");
         }
         options.add(Informer->GetOptionsDescription());
         options.add(Sourcer->GetOptionsDescription());
@@ -598,7 +675,10 @@ namespace
     std::unique_ptr<DisplayComponent> Display;
     uint_t SeekStep = 10;
     uint_t BenchmarkIterations;
+    String BenchmarkReport;
     bool DumpUnknownData = false;
+    bool DumpMetrics = false;
+    String TraceFile;
   };
 }  // namespace
 
@@ -322,12 +322,17 @@ namespace
         {" IO providers options:"},
         {Parameters::ZXTune::IO::Providers::File::MMAP_THRESHOLD, "minimal size for use memory mapping",
          Parameters::ZXTune::IO::Providers::File::MMAP_THRESHOLD_DEFAULT},
+        {Parameters::ZXTune::IO::Providers::File::MMAP_ADVICE,
+         "access pattern hint for memory mapped files (0- none, 1- sequential, 2- read in advance)",
+         Parameters::ZXTune::IO::Providers::File::MMAP_ADVICE_DEFAULT},
         {Parameters::ZXTune::IO::Providers::File::CREATE_DIRECTORIES,
          "create all intermediate directories (applicable for for file-based backends)",
          Parameters::ZXTune::IO::Providers::File::CREATE_DIRECTORIES_DEFAULT},
         {Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING,
          "overwrite target file if already exists (applicable for for file-based backends)",
          Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING_DEFAULT},
+        {Parameters::ZXTune::IO::Providers::Network::Http::CACHE_DIRECTORY,
+         "directory to keep downloaded http resources at (revalidated and resumed on next access)", EMPTY},
         // Sound parameters
         {" Sound options:"},
         {Parameters::ZXTune::Sound::FREQUENCY, "sound frequency in Hz", Parameters::ZXTune::Sound::FREQUENCY_DEFAULT},
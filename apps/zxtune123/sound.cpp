@@ -18,6 +18,7 @@
 #include "parameters/merged_accessor.h"
 #include "parameters/serialize.h"
 #include "platform/application.h"
+#include "sound/backend_attrs.h"
 #include "sound/backends_parameters.h"
 #include "sound/render_params.h"
 #include "sound/service.h"
@@ -37,6 +38,7 @@
 #include <list>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -166,6 +168,11 @@ namespace
         Dbg("Using previously succeed backend {}", UsedId);
         return Service->CreateBackend(Sound::BackendId::FromString(UsedId), module, callback);
       }
+      if (const auto targets = GetFileTargets(); targets.size() > 1)
+      {
+        Dbg("Saving to {} files at once", targets.size());
+        return Service->CreateBackend(targets, module, callback);
+      }
       for (const auto& info : Service->EnumerateBackends())
       {
         const auto id = info->Id();
@@ -203,6 +210,24 @@ namespace
     }
 
   private:
+    //! @return all the specified backends if they are file ones
+    std::vector<Sound::BackendId> GetFileTargets() const
+    {
+      std::vector<Sound::BackendId> result;
+      for (const auto& info : Service->EnumerateBackends())
+      {
+        if (BackendOptions.count(info->Id()))
+        {
+          if (Sound::CAP_TYPE_FILE != (info->Capabilities() & Sound::CAP_TYPE_MASK))
+          {
+            return {};
+          }
+          result.push_back(info->Id());
+        }
+      }
+      return result;
+    }
+
     String* GetSoundOption(Parameters::Identifier name)
     {
       return &SoundOptions[name.AsString()];
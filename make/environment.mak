@@ -13,7 +13,7 @@ android.cxx.flags = -no-canonical-prefixes -funwind-tables -fstack-protector-str
 android.ld.flags = -no-canonical-prefixes -Wl,-soname,$(notdir $@) -Wl,--no-undefined -Wl,-z,noexecstack -Wl,-z,relro -Wl,-z,now -static-libstdc++ -fuse-ld=lld -flto -Wl,--icf=all
 #assume that all the platforms are little-endian
 #this required to use boost which doesn't know anything about __armel__ or __mipsel__
-defines.android += ANDROID __ANDROID__ __LITTLE_ENDIAN__ NO_DEBUG_LOGS NO_L10N LITTLE_ENDIAN
+defines.android += ANDROID __ANDROID__ __LITTLE_ENDIAN__ NO_DEBUG_LOGS NO_METRICS NO_L10N LITTLE_ENDIAN
 
 #mingw
 mingw.cxx.flags = -mno-ms-bitfields
@@ -0,0 +1,171 @@
+'''
+Performance regression harness.
+
+Runs zxtune123 in benchmark mode for every module of corpus using each of interpolation levels and collects
+detection time, rendering speed, seek latency, output checksum and peak memory usage of the process.
+Results are stored to json/csv file and optionally compared against previously stored baseline.
+
+Usage:
+  perf_regression.py --zxtune123 <binary> [--iterations N] [--output results.{json,csv}]
+                     [--baseline baseline.json] [--tolerance percents] <files or dirs>...
+'''
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# quality levels mapped to per-chip interpolation options
+LEVELS = {
+  'none': 0,
+  'lq': 1,
+  'hq': 2,
+}
+
+# service files stored near modules in regression corpus
+SKIPPED_SUFFIXES = ('.debugay', '.dump', '.info', '.xsd', '.json', '.csv', 'Makefile')
+
+# metric name -> True if bigger value is better
+METRICS = {
+  'detect_ms': False,
+  'speed': True,
+  'seek_ms': False,
+  'rss_kb': False,
+}
+
+# timings below this value are too noisy to compare in relative terms
+MIN_COMPARABLE_MS = 1.0
+
+class Corpus(object):
+  @staticmethod
+  def list_files(paths):
+    queue = list(paths)
+    while queue:
+      to_scan = queue.pop(0)
+      if os.path.isfile(to_scan):
+        if not to_scan.endswith(SKIPPED_SUFFIXES):
+          yield to_scan
+      elif os.path.isdir(to_scan):
+        for entry in sorted(os.scandir(to_scan), key=lambda e: e.name):
+          queue.append(entry.path)
+
+class Runner(object):
+  def __init__(self, binary, iterations):
+    self._binary = binary
+    self._iterations = iterations
+
+  def run(self, path, level):
+    interpolation = LEVELS[level]
+    options = 'aym.interpolation={0},saa.interpolation={0},sid.interpolation={0},dac.interpolation={1}'.format(
+      interpolation, min(interpolation, 1))
+    with tempfile.TemporaryDirectory() as tmp:
+      report = os.path.join(tmp, 'report.csv')
+      args = [self._binary, '--benchmark', str(self._iterations), '--benchmark-report', report,
+              '--core-options', options, path]
+      proc = subprocess.Popen(args, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+      # per-process usage, RUSAGE_CHILDREN accumulates maximum among all the children
+      _, status, usage = os.wait4(proc.pid, 0)
+      proc.returncode = os.waitstatus_to_exitcode(status)
+      if proc.returncode != 0 or not os.path.exists(report):
+        raise Exception('Failed to benchmark {} (code {})'.format(path, proc.returncode))
+      with open(report, newline='') as f:
+        for row in csv.DictReader(f):
+          yield {
+            'path': row['path'],
+            'type': row['type'],
+            'level': level,
+            'detect_ms': float(row['detect_ms']),
+            'speed': float(row['speed']),
+            'seek_ms': float(row['seek_ms']),
+            'crc': row['crc'],
+            # Linux reports kilobytes
+            'rss_kb': usage.ru_maxrss,
+          }
+
+def get_key(result):
+  return (result['path'], result['level'])
+
+def load_results(path):
+  if path.endswith('.csv'):
+    with open(path, newline='') as f:
+      result = list()
+      for row in csv.DictReader(f):
+        for metric in METRICS:
+          row[metric] = float(row[metric])
+        result.append(row)
+      return result
+  with open(path) as f:
+    return json.load(f)
+
+def store_results(results, path):
+  if path.endswith('.csv'):
+    with open(path, 'w', newline='') as f:
+      writer = csv.DictWriter(f, fieldnames=['path', 'type', 'level', 'detect_ms', 'speed', 'seek_ms', 'crc', 'rss_kb'])
+      writer.writeheader()
+      writer.writerows(results)
+  else:
+    with open(path, 'w') as f:
+      json.dump(results, f, indent=1)
+
+def is_regressed(metric, base, current, tolerance):
+  if metric.endswith('_ms') and max(base, current) < MIN_COMPARABLE_MS:
+    return False
+  if METRICS[metric]:
+    return current < base * (1 - tolerance / 100)
+  else:
+    return current > base * (1 + tolerance / 100)
+
+def compare(baseline, results, tolerance, out):
+  base = {get_key(r): r for r in baseline}
+  failures = 0
+  for res in results:
+    key = get_key(res)
+    ref = base.get(key)
+    if ref is None:
+      print('New\t{}\t{}'.format(*key), file=out)
+      continue
+    if ref['crc'] != res['crc']:
+      print('Changed\t{}\t{}\tcrc {} -> {}'.format(*key, ref['crc'], res['crc']), file=out)
+      failures += 1
+    for metric in METRICS:
+      if is_regressed(metric, ref[metric], res[metric], tolerance):
+        print('Regressed\t{}\t{}\t{} {} -> {}'.format(*key, metric, ref[metric], res[metric]), file=out)
+        failures += 1
+  return failures
+
+def main():
+  parser = argparse.ArgumentParser(description='zxtune performance regression harness')
+  parser.add_argument('--zxtune123', required=True, help='path to zxtune123 binary')
+  parser.add_argument('--iterations', type=int, default=1, help='rendering iterations per module')
+  parser.add_argument('--levels', default=','.join(LEVELS), help='comma-separated interpolation levels')
+  parser.add_argument('--output', help='file to store results to (.json or .csv)')
+  parser.add_argument('--baseline', help='previously stored results to compare with')
+  parser.add_argument('--tolerance', type=float, default=10, help='allowed deviation in percents')
+  parser.add_argument('inputs', nargs='+', help='files or directories to process')
+  args = parser.parse_args()
+
+  runner = Runner(args.zxtune123, args.iterations)
+  results = list()
+  errors = 0
+  for path in Corpus.list_files(args.inputs):
+    for level in args.levels.split(','):
+      try:
+        for res in runner.run(path, level):
+          print('{level}\tx{speed:.2f}\tdetect={detect_ms:.3f}ms\tseek={seek_ms:.3f}ms\trss={rss_kb}kB\t{path}'.format(**res))
+          results.append(res)
+      except Exception as e:
+        print(e, file=sys.stderr)
+        errors += 1
+  if args.output:
+    store_results(results, args.output)
+  if args.baseline:
+    failures = compare(load_results(args.baseline), results, args.tolerance, sys.stdout)
+    print('{} regressions found'.format(failures))
+    errors += failures
+  return 1 if errors else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
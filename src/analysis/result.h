@@ -32,6 +32,9 @@ namespace Analysis
     //! @invariant Return >0 if current data not matches format (up to input data's size if no matches at all)
     //! @invariant Return 0 if input data matches
     virtual std::size_t GetLookaheadOffset() const = 0;
+    //! @brief Search format only in the first limit bytes of forward data
+    //! @return Same as GetLookaheadOffset() for matches fully located in limited data
+    virtual std::size_t GetLookaheadOffset(std::size_t limit) const = 0;
   };
 
   Result::Ptr CreateMatchedResult(std::size_t matchedSize);
@@ -34,6 +34,11 @@ namespace Analysis
       return UnmatchedSize;
     }
 
+    std::size_t GetLookaheadOffset(std::size_t /*limit*/) const override
+    {
+      return UnmatchedSize;
+    }
+
   private:
     const std::size_t MatchedSize;
     const std::size_t UnmatchedSize;
@@ -57,6 +62,12 @@ namespace Analysis
       return Format->NextMatchOffset(*RawData);
     }
 
+    std::size_t GetLookaheadOffset(std::size_t limit) const override
+    {
+      const Binary::View data(*RawData);
+      return Format->NextMatchOffset(limit < data.Size() ? data.SubView(0, limit) : data);
+    }
+
   private:
     const Binary::Format::Ptr Format;
     const Binary::Container::Ptr RawData;
@@ -11,6 +11,7 @@
 #include "analysis/scanner.h"
 
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "tools/iterators.h"
 
 #include "contract.h"
@@ -22,6 +23,8 @@
 namespace Analysis
 {
   const Debug::Stream Dbg("Analysis::Scanner");
+  static auto& ScanTime = Metrics::GetHistogram("analysis.scan_ns");
+  static auto& ScannedBytes = Metrics::GetCounter("analysis.scan.bytes");
 
   using namespace Formats;
 
@@ -413,6 +416,8 @@ namespace Analysis
       DecodeUnrecognizedTarget<PackedDataTraits> packed(Decoders.Packed, target, image.GetUnrecognizedTarget());
       DecodeUnrecognizedTarget<ArchivedDataTraits> archived(Decoders.Archived, target, packed.GetUnrecognizedTarget());
 
+      const Metrics::ScopedTimer timer(ScanTime);
+      ScannedBytes.Add(data->Size());
       archived.Apply(0, data);
     }
 
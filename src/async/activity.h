@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "async/executor.h"
+
 #include "error.h"
 
 namespace Async
@@ -34,7 +36,9 @@ namespace Async
     //! @throw Error if Operation execution failed
     virtual void Wait() = 0;
 
+    //! @brief Executes operation with Priority::INTERACTIVE
     static Ptr Create(Operation::Ptr operation);
+    static Ptr Create(Priority prio, Operation::Ptr operation);
     static Ptr CreateStub();
   };
 }  // namespace Async
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "async/executor.h"
 #include "async/job.h"
 
 namespace Async
@@ -37,5 +38,7 @@ namespace Async
     virtual void Execute(Scheduler& sch) = 0;
   };
 
+  //! @brief Executes routine with Priority::INTERACTIVE
   Job::Ptr CreateJob(Coroutine::Ptr routine);
+  Job::Ptr CreateJob(Priority prio, Coroutine::Ptr routine);
 }  // namespace Async
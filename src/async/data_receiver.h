@@ -12,7 +12,7 @@
 
 #include "async/activity.h"
 #include "async/progress.h"
-#include "async/sized_queue.h"
+#include "async/ring_queue.h"
 #include "tools/data_streaming.h"
 
 #include "contract.h"
@@ -28,7 +28,7 @@ namespace Async
   {
   public:
     DataReceiver(std::size_t workersCount, std::size_t queueSize, typename ::DataReceiver<T>::Ptr delegate)
-      : QueueObject(SizedQueue<T>::Create(queueSize))
+      : QueueObject(RingQueue<T>::Create(queueSize))
       , Statistic(Progress::Create())
       , Delegate(std::move(delegate))
     {
@@ -74,7 +74,8 @@ namespace Async
       const typename Operation::Ptr op = MakePtr<TransceiveOperation>(QueueObject, Statistic, Delegate);
       while (Activities.size() < count)
       {
-        const Activity::Ptr act = Activity::Create(op);
+        // workers are blocked by queue for the whole receiver lifetime, so should not wait for free background one
+        const Activity::Ptr act = Activity::Create(Priority::INTERACTIVE, op);
         Activities.push_back(act);
       }
     }
@@ -0,0 +1,63 @@
+/**
+ *
+ * @file
+ *
+ * @brief Process-wide tasks executor interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+
+namespace Async
+{
+  //! Priority classes of submitted tasks. Pending tasks are taken by workers in order of priority.
+  enum class Priority
+  {
+    //! Playback. Never waits for free worker
+    REALTIME,
+    //! User-initiated actions. Never waits for free worker
+    INTERACTIVE,
+    //! Bulk processing (scanning, conversion etc). Waits for free worker when all the cores are busy
+    BACKGROUND,
+
+    COUNT
+  };
+
+  struct ExecutorStatistics
+  {
+    //! Tasks waiting for worker per priority class
+    std::array<std::size_t, static_cast<std::size_t>(Priority::COUNT)> QueueDepth = {};
+    //! Alive worker threads
+    std::size_t Workers = 0;
+    //! Worker threads executing tasks now
+    std::size_t BusyWorkers = 0;
+    //! Tasks executed since process start
+    std::size_t ExecutedTasks = 0;
+  };
+
+  /*
+    Pool of reusable worker threads shared by all the activities in process.
+    Tasks may block for a long time (waiting for data, paused playback etc), so pool grows on demand instead of
+    limiting concurrency strictly. Idle workers are stopped after timeout.
+  */
+  class Executor
+  {
+  public:
+    using Task = std::function<void()>;
+
+    virtual ~Executor() = default;
+
+    //! @param task Should not throw any exceptions
+    virtual void Submit(Priority prio, Task task) = 0;
+
+    virtual ExecutorStatistics GetStatistics() const = 0;
+
+    static Executor& Instance();
+  };
+}  // namespace Async
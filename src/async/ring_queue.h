@@ -0,0 +1,229 @@
+/**
+ *
+ * @file
+ *
+ * @brief Lock-free bounded implementation of Queue
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "async/queue.h"
+
+#include "contract.h"
+#include "make_ptr.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Async
+{
+  /*
+    Bounded multiple producers/multiple consumers ring buffer with per-cell sequence counters.
+    Add/Get are lock-free while queue is neither full nor empty. Otherwise caller spins a bit and then
+    sleeps on condition variable, so counterpart touches mutex only if somebody is really waiting.
+  */
+  template<class T>
+  class RingQueue : public Queue<T>
+  {
+  public:
+    explicit RingQueue(std::size_t maxSize)
+      : Capacity(maxSize)
+      , Cells(new Cell[maxSize])
+    {
+      Require(maxSize != 0);
+      for (std::size_t idx = 0; idx != Capacity; ++idx)
+      {
+        Cells[idx].Sequence.store(idx, std::memory_order_relaxed);
+      }
+    }
+
+    void Add(T val) override
+    {
+      while (Active.load(std::memory_order_acquire))
+      {
+        if (TryPush(val))
+        {
+          Wakeup(GetWaiters, CanGetDataEvent);
+          return;
+        }
+        Wait(PutWaiters, CanPutDataEvent, [this]() { return !Active || CanPutData(); });
+      }
+    }
+
+    bool Get(T& res) override
+    {
+      while (Active.load(std::memory_order_acquire))
+      {
+        if (TryPop(res))
+        {
+          Wakeup(PutWaiters, CanPutDataEvent);
+          return true;
+        }
+        Wait(GetWaiters, CanGetDataEvent, [this]() { return !Active || CanGetData(); });
+      }
+      return false;
+    }
+
+    void Reset() override
+    {
+      Active.store(false, std::memory_order_release);
+      for (T dummy; TryPop(dummy);)
+      {
+      }
+      const std::lock_guard<std::mutex> lock(Locker);
+      CanGetDataEvent.notify_all();
+      CanPutDataEvent.notify_all();
+    }
+
+    void Flush() override
+    {
+      while (!IsEmpty())
+      {
+        Wait(PutWaiters, CanPutDataEvent, [this]() { return !Active || IsEmpty(); });
+        if (!Active)
+        {
+          break;
+        }
+      }
+    }
+
+    static typename Queue<T>::Ptr Create(std::size_t size)
+    {
+      return MakePtr<RingQueue<T> >(size);
+    }
+
+  private:
+    bool TryPush(T& val)
+    {
+      auto pos = EnqueuePos.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        auto& cell = Cells[pos % Capacity];
+        const auto seq = cell.Sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+        if (diff == 0)
+        {
+          if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            cell.Value = std::move(val);
+            cell.Sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0)
+        {
+          // full
+          return false;
+        }
+        else
+        {
+          pos = EnqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    bool TryPop(T& res)
+    {
+      auto pos = DequeuePos.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        auto& cell = Cells[pos % Capacity];
+        const auto seq = cell.Sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if (diff == 0)
+        {
+          if (DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            res = std::move(cell.Value);
+            // do not keep resources of already taken value
+            cell.Value = T();
+            cell.Sequence.store(pos + Capacity, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0)
+        {
+          // empty
+          return false;
+        }
+        else
+        {
+          pos = DequeuePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    bool CanPutData() const
+    {
+      const auto pos = EnqueuePos.load(std::memory_order_seq_cst);
+      return Cells[pos % Capacity].Sequence.load(std::memory_order_seq_cst) == pos;
+    }
+
+    bool CanGetData() const
+    {
+      const auto pos = DequeuePos.load(std::memory_order_seq_cst);
+      return Cells[pos % Capacity].Sequence.load(std::memory_order_seq_cst) == pos + 1;
+    }
+
+    bool IsEmpty() const
+    {
+      return DequeuePos.load(std::memory_order_seq_cst) == EnqueuePos.load(std::memory_order_seq_cst);
+    }
+
+    template<class Predicate>
+    void Wait(std::atomic<std::size_t>& waiters, std::condition_variable& event, Predicate pred)
+    {
+      for (std::size_t spin = 0; spin != SPIN_COUNT; ++spin)
+      {
+        if (pred())
+        {
+          return;
+        }
+        std::this_thread::yield();
+      }
+      std::unique_lock<std::mutex> lock(Locker);
+      // counter is published before predicate check, so Wakeup either sees it or the state change is visible here
+      waiters.fetch_add(1, std::memory_order_seq_cst);
+      event.wait(lock, pred);
+      waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void Wakeup(std::atomic<std::size_t>& waiters, std::condition_variable& event)
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (waiters.load(std::memory_order_relaxed) != 0)
+      {
+        const std::lock_guard<std::mutex> lock(Locker);
+        event.notify_all();
+      }
+    }
+
+  private:
+    static const std::size_t SPIN_COUNT = 16;
+    static const std::size_t CACHE_LINE_SIZE = 64;
+
+    struct alignas(CACHE_LINE_SIZE) Cell
+    {
+      std::atomic<std::size_t> Sequence;
+      T Value;
+    };
+
+    const std::size_t Capacity;
+    const std::unique_ptr<Cell[]> Cells;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> EnqueuePos = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> DequeuePos = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> Active = true;
+    std::atomic<std::size_t> PutWaiters = 0;
+    std::atomic<std::size_t> GetWaiters = 0;
+    std::mutex Locker;
+    std::condition_variable CanPutDataEvent;
+    std::condition_variable CanGetDataEvent;
+  };
+}  // namespace Async
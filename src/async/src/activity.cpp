@@ -10,13 +10,13 @@
 
 #include "async/activity.h"
 
+#include "async/executor.h"
 #include "async/src/event.h"
 
 #include "make_ptr.h"
 #include "pointers.h"
 
 #include <cassert>
-#include <thread>
 
 namespace Async
 {
@@ -28,28 +28,34 @@ namespace Async
     STARTED
   };
 
-  class ThreadActivity : public Activity
+  class PooledActivity : public Activity
   {
   public:
-    using Ptr = std::shared_ptr<ThreadActivity>;
+    using Ptr = std::shared_ptr<PooledActivity>;
 
-    explicit ThreadActivity(Operation::Ptr op)
+    explicit PooledActivity(Operation::Ptr op)
       : Oper(std::move(op))
       , State(ActivityState::STOPPED)
     {}
 
-    ~ThreadActivity() override
+    ~PooledActivity() override
     {
       assert(!IsExecuted() || !"Should call Activity::Wait before stop");
+      WaitForTask();
     }
 
-    void Start()
+    void Start(Priority prio)
     {
-      Thread = std::thread(&ThreadActivity::WorkProc, this);
+      // task does not own activity, so operation is released by the owner's thread
+      auto finished = std::make_shared<Event<bool>>();
+      Executor::Instance().Submit(prio, [this, finished]() {
+        WorkProc();
+        finished->Set(true);
+      });
+      Finished = std::move(finished);
       if (ActivityState::FAILED == State.WaitForAny(ActivityState::INITIALIZED, ActivityState::FAILED))
       {
-        Thread.join();
-        State.Set(ActivityState::STOPPED);
+        Finished->Wait(true);
         throw LastError;
       }
       State.Set(ActivityState::STARTED);
@@ -62,14 +68,20 @@ namespace Async
 
     void Wait() override
     {
-      if (Thread.joinable())
-      {
-        Thread.join();
-      }
+      WaitForTask();
       ThrowIfError(LastError);
     }
 
   private:
+    void WaitForTask()
+    {
+      // worker may still access activity after operation's result is set
+      if (Finished)
+      {
+        Finished->Wait(true);
+      }
+    }
+
     void WorkProc()
     {
       LastError = Error();
@@ -91,8 +103,8 @@ namespace Async
   private:
     const Operation::Ptr Oper;
     Event<ActivityState> State;
-    std::thread Thread;
     Error LastError;
+    std::shared_ptr<Event<bool>> Finished;
   };
 
   class StubActivity : public Activity
@@ -111,8 +123,13 @@ namespace Async
 {
   Activity::Ptr Activity::Create(Operation::Ptr operation)
   {
-    auto result = MakePtr<ThreadActivity>(std::move(operation));
-    result->Start();
+    return Create(Priority::INTERACTIVE, std::move(operation));
+  }
+
+  Activity::Ptr Activity::Create(Priority prio, Operation::Ptr operation)
+  {
+    auto result = MakePtr<PooledActivity>(std::move(operation));
+    result->Start(prio);
     return result;
   }
 
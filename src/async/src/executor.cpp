@@ -0,0 +1,200 @@
+/**
+ *
+ * @file
+ *
+ * @brief Process-wide tasks executor implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "async/executor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Async
+{
+  // idle worker is stopped after this period
+  const auto IDLE_TIMEOUT = std::chrono::seconds(10);
+  // background tasks wait for free worker no longer than this period when no progress is made
+  const auto INJECTION_DELAY = std::chrono::milliseconds(100);
+
+  class PoolExecutor : public Executor
+  {
+  public:
+    PoolExecutor()
+      : MaxBackgroundWorkers(std::max<std::size_t>(2, std::thread::hardware_concurrency()))
+    {}
+
+    void Submit(Priority prio, Task task) override
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      GetQueue(prio).push_back(std::move(task));
+      if (IdleWorkers >= GetPendingCount())
+      {
+        WorkAvailable.notify_one();
+      }
+      else if (prio != Priority::BACKGROUND || BusyBackgroundWorkers + StartingWorkers < MaxBackgroundWorkers)
+      {
+        StartWorker();
+      }
+      else
+      {
+        StartInjector();
+        InjectionRequired.notify_one();
+      }
+    }
+
+    ExecutorStatistics GetStatistics() const override
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      ExecutorStatistics res;
+      std::transform(Pending.begin(), Pending.end(), res.QueueDepth.begin(),
+                     [](const std::deque<Task>& queue) { return queue.size(); });
+      res.Workers = Workers;
+      res.BusyWorkers = BusyWorkers;
+      res.ExecutedTasks = ExecutedTasks;
+      return res;
+    }
+
+  private:
+    std::deque<Task>& GetQueue(Priority prio)
+    {
+      return Pending[static_cast<std::size_t>(prio)];
+    }
+
+    std::size_t GetPendingCount() const
+    {
+      std::size_t res = 0;
+      for (const auto& queue : Pending)
+      {
+        res += queue.size();
+      }
+      return res;
+    }
+
+    Task PopTask(Priority& prio)
+    {
+      // queues are ordered by priority
+      for (std::size_t idx = 0; idx != Pending.size(); ++idx)
+      {
+        auto& queue = Pending[idx];
+        if (!queue.empty())
+        {
+          auto res = std::move(queue.front());
+          queue.pop_front();
+          ++StartedTasks;
+          prio = static_cast<Priority>(idx);
+          return res;
+        }
+      }
+      return {};
+    }
+
+    void StartWorker()
+    {
+      std::thread(&PoolExecutor::WorkProc, this).detach();
+      ++Workers;
+      // treat starting worker as idle to avoid excessive workers creation while thread is not scheduled yet
+      ++IdleWorkers;
+      ++StartingWorkers;
+    }
+
+    void StartInjector()
+    {
+      if (!InjectorStarted)
+      {
+        std::thread(&PoolExecutor::InjectorProc, this).detach();
+        InjectorStarted = true;
+      }
+    }
+
+    void WorkProc()
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      --StartingWorkers;
+      for (;;)
+      {
+        const auto hasTasks =
+            WorkAvailable.wait_for(lock, IDLE_TIMEOUT, [this]() { return GetPendingCount() != 0; });
+        --IdleWorkers;
+        if (!hasTasks)
+        {
+          --Workers;
+          return;
+        }
+        auto prio = Priority::BACKGROUND;
+        auto task = PopTask(prio);
+        // only background tasks are limited, so blocked realtime or idle workers do not delay them
+        const std::size_t background = prio == Priority::BACKGROUND;
+        ++BusyWorkers;
+        BusyBackgroundWorkers += background;
+        lock.unlock();
+        Execute(std::move(task));
+        lock.lock();
+        --BusyWorkers;
+        BusyBackgroundWorkers -= background;
+        ++IdleWorkers;
+        ++ExecutedTasks;
+      }
+    }
+
+    // task is destroyed here as well- it may hold arbitrary resources
+    static void Execute(Task task)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+        // should not get here, but keep worker alive anyway
+      }
+    }
+
+    // Starts additional worker if background tasks are stalled, e.g. all the workers are blocked by tasks waiting
+    // for the queued ones
+    void InjectorProc()
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      for (;;)
+      {
+        auto& queue = GetQueue(Priority::BACKGROUND);
+        InjectionRequired.wait(lock, [&queue]() { return !queue.empty(); });
+        const auto started = StartedTasks;
+        if (!InjectionRequired.wait_for(lock, INJECTION_DELAY, [&queue]() { return queue.empty(); })
+            && started == StartedTasks && IdleWorkers < GetPendingCount())
+        {
+          StartWorker();
+        }
+      }
+    }
+
+  private:
+    const std::size_t MaxBackgroundWorkers;
+    mutable std::mutex Guard;
+    std::condition_variable WorkAvailable;
+    std::condition_variable InjectionRequired;
+    std::array<std::deque<Task>, static_cast<std::size_t>(Priority::COUNT)> Pending;
+    std::size_t Workers = 0;
+    std::size_t IdleWorkers = 0;
+    std::size_t BusyWorkers = 0;
+    std::size_t BusyBackgroundWorkers = 0;
+    std::size_t StartingWorkers = 0;
+    std::size_t StartedTasks = 0;
+    std::size_t ExecutedTasks = 0;
+    bool InjectorStarted = false;
+  };
+
+  Executor& Executor::Instance()
+  {
+    // intentionally never destroyed- detached workers may still use it at exit
+    static auto* const instance = new PoolExecutor();
+    return *instance;
+  }
+}  // namespace Async
@@ -115,8 +115,9 @@ namespace Async
   class CoroutineJob : public Job
   {
   public:
-    explicit CoroutineJob(Coroutine::Ptr routine)
-      : Routine(std::move(routine))
+    CoroutineJob(Priority prio, Coroutine::Ptr routine)
+      : Prio(prio)
+      , Routine(std::move(routine))
     {}
 
     ~CoroutineJob() override
@@ -139,7 +140,7 @@ namespace Async
         FinishAction();
       }
       const Operation::Ptr jobOper = MakePtr<CoroutineOperation>(Routine, State);
-      Act = Activity::Create(jobOper);
+      Act = Activity::Create(Prio, jobOper);
       State.Set(JobState::STARTED);
     }
 
@@ -229,6 +230,7 @@ namespace Async
     }
 
   private:
+    const Priority Prio;
     const Coroutine::Ptr Routine;
     mutable std::mutex Mutex;
     Event<JobState> State;
@@ -240,6 +242,11 @@ namespace Async
 {
   Job::Ptr CreateJob(Coroutine::Ptr routine)
   {
-    return MakePtr<CoroutineJob>(std::move(routine));
+    return CreateJob(Priority::INTERACTIVE, std::move(routine));
+  }
+
+  Job::Ptr CreateJob(Priority prio, Coroutine::Ptr routine)
+  {
+    return MakePtr<CoroutineJob>(prio, std::move(routine));
   }
 }  // namespace Async
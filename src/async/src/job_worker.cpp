@@ -61,8 +61,13 @@ namespace Async
 namespace Async
 {
   Job::Ptr CreateJob(Worker::Ptr worker)
+  {
+    return CreateJob(Priority::INTERACTIVE, std::move(worker));
+  }
+
+  Job::Ptr CreateJob(Priority prio, Worker::Ptr worker)
   {
     auto routine = MakePtr<WorkerCoroutine>(std::move(worker));
-    return CreateJob(std::move(routine));
+    return CreateJob(prio, std::move(routine));
   }
 }  // namespace Async
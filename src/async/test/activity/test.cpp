@@ -9,9 +9,13 @@
  **/
 
 #include "async/activity.h"
+#include "async/data_receiver.h"
+#include "async/executor.h"
 
 #include "make_ptr.h"
 
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <thread>
 
@@ -72,6 +76,24 @@ namespace
     }
   };
 
+  class TrackedOperation : public Operation
+  {
+  public:
+    explicit TrackedOperation(std::shared_ptr<int> token)
+      : Token(std::move(token))
+    {}
+
+    void Prepare() override {}
+
+    void Execute() override
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+  private:
+    const std::shared_ptr<int> Token;
+  };
+
   void TestInvalidActivity()
   {
     std::cout << "Test for invalid activity" << std::endl;
@@ -143,6 +165,65 @@ namespace
     result->Wait();
     std::cout << "Succeed\n";
   }
+
+  void TestActivityOperationRelease()
+  {
+    std::cout << "Test for activity operation release" << std::endl;
+    for (int attempt = 0; attempt < 10; ++attempt)
+    {
+      const auto token = std::make_shared<int>();
+      {
+        const Activity::Ptr result = Activity::Create(MakePtr<TrackedOperation>(token));
+        result->Wait();
+      }
+      if (token.use_count() != 1)
+      {
+        throw Error(THIS_LINE, "Operation should be released with activity");
+      }
+    }
+    std::cout << "Succeed\n";
+  }
+
+  class NullReceiver : public ::DataReceiver<int>
+  {
+  public:
+    void ApplyData(int) override {}
+    void Flush() override {}
+  };
+
+  void TestManyDataReceivers()
+  {
+    std::cout << "Test for data receivers over cores count" << std::endl;
+    const std::size_t cores = std::max(2u, std::thread::hardware_concurrency());
+    // occupy all the background slots as well
+    std::promise<void> release;
+    const auto released = release.get_future().share();
+    for (std::size_t idx = 0; idx != cores; ++idx)
+    {
+      Executor::Instance().Submit(Priority::BACKGROUND, [released]() { released.wait(); });
+    }
+    std::vector<::DataReceiver<int>::Ptr> receivers;
+    auto maxElapsed = std::chrono::steady_clock::duration::zero();
+    for (std::size_t idx = 0; idx != 2 * cores + 2; ++idx)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      receivers.push_back(Async::DataReceiver<int>::Create(1, 4, MakePtr<NullReceiver>()));
+      maxElapsed = std::max(maxElapsed, std::chrono::steady_clock::now() - start);
+    }
+    for (const auto& recv : receivers)
+    {
+      recv->ApplyData(1);
+      recv->Flush();
+    }
+    receivers.clear();
+    release.set_value();
+    // injection delay is 100ms
+    if (maxElapsed > std::chrono::milliseconds(50))
+    {
+      throw Error(THIS_LINE, "Data receiver creation should not wait for free worker");
+    }
+    std::cout << "Succeed\n";
+  }
 }  // namespace
 
 int main()
@@ -152,10 +233,13 @@ int main()
     TestInvalidActivity();
     TestActivityErrorResult();
     TestLongActivity();
+    TestActivityOperationRelease();
+    TestManyDataReceivers();
   }
   catch (const Error& err)
   {
     std::cout << "Failed: \n";
     std::cerr << err.ToString();
+    return 1;
   }
 }
@@ -0,0 +1,159 @@
+/**
+ *
+ * @file
+ *
+ * @brief Asynchronous executor test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "async/executor.h"
+
+#include "error.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+  using namespace Async;
+
+  class Latch
+  {
+  public:
+    explicit Latch(std::size_t count)
+      : Count(count)
+    {}
+
+    void CountDown()
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (--Count == 0)
+      {
+        Event.notify_all();
+      }
+    }
+
+    bool Wait(std::chrono::milliseconds timeout)
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      return Event.wait_for(lock, timeout, [this]() { return Count == 0; });
+    }
+
+  private:
+    std::size_t Count;
+    std::mutex Guard;
+    std::condition_variable Event;
+  };
+
+  const auto TIMEOUT = std::chrono::milliseconds(10000);
+
+  void TestWorkersReuse()
+  {
+    std::cout << "Test for workers reuse" << std::endl;
+    auto& executor = Executor::Instance();
+    const auto before = executor.GetStatistics();
+    for (uint_t idx = 0; idx != 100; ++idx)
+    {
+      const auto done = std::make_shared<Latch>(1);
+      executor.Submit(Priority::INTERACTIVE, [done]() { done->CountDown(); });
+      if (!done->Wait(TIMEOUT))
+      {
+        throw Error(THIS_LINE, "Task is not executed");
+      }
+    }
+    // let the last task to be accounted
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    const auto after = executor.GetStatistics();
+    if (after.ExecutedTasks != before.ExecutedTasks + 100)
+    {
+      throw Error(THIS_LINE, "Invalid executed tasks count");
+    }
+    // worker may be still finishing previous task when next one is submitted
+    if (after.Workers > before.Workers + 4)
+    {
+      throw Error(THIS_LINE, "Workers are not reused");
+    }
+    std::cout << "Succeed\n";
+  }
+
+  void TestBlockingBackgroundTasks()
+  {
+    std::cout << "Test for blocking background tasks" << std::endl;
+    auto& executor = Executor::Instance();
+    // more than cores count, all are waiting for each other
+    const std::size_t count = 2 * std::max(2u, std::thread::hardware_concurrency()) + 1;
+    // shared to be alive until all the tasks are finished
+    const auto started = std::make_shared<Latch>(count);
+    const auto done = std::make_shared<Latch>(count);
+    for (std::size_t idx = 0; idx != count; ++idx)
+    {
+      executor.Submit(Priority::BACKGROUND, [started, done]() {
+        started->CountDown();
+        started->Wait(TIMEOUT);
+        done->CountDown();
+      });
+    }
+    if (!done->Wait(TIMEOUT))
+    {
+      throw Error(THIS_LINE, "Background tasks are stalled");
+    }
+    std::cout << "Succeed\n";
+  }
+
+  void TestRealtimeTasks()
+  {
+    std::cout << "Test for realtime tasks" << std::endl;
+    auto& executor = Executor::Instance();
+    // occupy all the idle workers left from previous tests as well
+    const std::size_t count = executor.GetStatistics().Workers + 2 * std::max(2u, std::thread::hardware_concurrency());
+    const auto release = std::make_shared<Latch>(1);
+    const auto done = std::make_shared<Latch>(count);
+    for (std::size_t idx = 0; idx != count; ++idx)
+    {
+      executor.Submit(Priority::BACKGROUND, [release, done]() {
+        release->Wait(TIMEOUT);
+        done->CountDown();
+      });
+    }
+    const auto realtime = std::make_shared<Latch>(1);
+    const auto start = std::chrono::steady_clock::now();
+    executor.Submit(Priority::REALTIME, [realtime]() { realtime->CountDown(); });
+    const bool executed = realtime->Wait(TIMEOUT);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto stat = executor.GetStatistics();
+    release->CountDown();
+    done->Wait(TIMEOUT);
+    if (!executed || elapsed > std::chrono::milliseconds(50))
+    {
+      throw Error(THIS_LINE, "Realtime task should not wait");
+    }
+    if (stat.QueueDepth[static_cast<std::size_t>(Priority::BACKGROUND)] == 0)
+    {
+      throw Error(THIS_LINE, "Background tasks should wait");
+    }
+    std::cout << "Succeed\n";
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestWorkersReuse();
+    TestBlockingBackgroundTasks();
+    TestRealtimeTasks();
+  }
+  catch (const Error& err)
+  {
+    std::cout << "Failed: \n";
+    std::cerr << err.ToString();
+    return 1;
+  }
+}
@@ -0,0 +1,166 @@
+/**
+ *
+ * @file
+ *
+ * @brief Asynchronous queues test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "async/ring_queue.h"
+#include "async/sized_queue.h"
+
+#include "error.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  using namespace Async;
+
+  using QueueFactory = Queue<uint_t>::Ptr (*)(std::size_t);
+
+  void TestOrder(QueueFactory factory)
+  {
+    std::cout << " order" << std::endl;
+    const auto queue = factory(4);
+    for (uint_t val = 1; val <= 4; ++val)
+    {
+      queue->Add(val);
+    }
+    for (uint_t ref = 1; ref <= 4; ++ref)
+    {
+      uint_t val = 0;
+      if (!queue->Get(val) || val != ref)
+      {
+        throw Error(THIS_LINE, "Invalid order");
+      }
+    }
+  }
+
+  void TestBlockingWhenFull(QueueFactory factory)
+  {
+    std::cout << " blocking when full" << std::endl;
+    const auto queue = factory(2);
+    std::atomic<uint_t> added = 0;
+    std::thread producer([&]() {
+      for (uint_t val = 0; val != 3; ++val)
+      {
+        queue->Add(val);
+        ++added;
+      }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (added != 2)
+    {
+      throw Error(THIS_LINE, "Should block on full queue");
+    }
+    uint_t val = 0;
+    queue->Get(val);
+    producer.join();
+    if (added != 3)
+    {
+      throw Error(THIS_LINE, "Should unblock after Get");
+    }
+  }
+
+  void TestConcurrentAccess(QueueFactory factory)
+  {
+    std::cout << " concurrent access" << std::endl;
+    const uint_t THREADS = 4;
+    const uint_t ITEMS = 100000;
+    const auto queue = factory(16);
+    std::atomic<uint64_t> received = 0;
+    std::atomic<uint64_t> sum = 0;
+    std::vector<std::thread> consumers;
+    for (uint_t idx = 0; idx != THREADS; ++idx)
+    {
+      consumers.emplace_back([&]() {
+        for (uint_t val = 0; queue->Get(val);)
+        {
+          ++received;
+          sum += val;
+        }
+      });
+    }
+    std::vector<std::thread> producers;
+    for (uint_t idx = 0; idx != THREADS; ++idx)
+    {
+      producers.emplace_back([&]() {
+        for (uint_t val = 1; val <= ITEMS; ++val)
+        {
+          queue->Add(val);
+        }
+      });
+    }
+    for (auto& thr : producers)
+    {
+      thr.join();
+    }
+    queue->Flush();
+    // Flush waits for items taken, not processed
+    while (received != THREADS * ITEMS)
+    {
+      std::this_thread::yield();
+    }
+    queue->Reset();
+    for (auto& thr : consumers)
+    {
+      thr.join();
+    }
+    if (sum != uint64_t(THREADS) * ITEMS * (ITEMS + 1) / 2)
+    {
+      throw Error(THIS_LINE, "Invalid items received");
+    }
+  }
+
+  void TestReset(QueueFactory factory)
+  {
+    std::cout << " reset" << std::endl;
+    const auto queue = factory(1);
+    std::thread consumer([&]() {
+      uint_t val = 0;
+      while (queue->Get(val))
+      {
+      }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    queue->Reset();
+    consumer.join();
+    queue->Add(1);
+    uint_t val = 0;
+    if (queue->Get(val))
+    {
+      throw Error(THIS_LINE, "Should not get data after reset");
+    }
+  }
+
+  void TestQueue(const char* name, QueueFactory factory)
+  {
+    std::cout << "Test for " << name << std::endl;
+    TestOrder(factory);
+    TestBlockingWhenFull(factory);
+    TestConcurrentAccess(factory);
+    TestReset(factory);
+    std::cout << "Succeed\n";
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestQueue("SizedQueue", &SizedQueue<uint_t>::Create);
+    TestQueue("RingQueue", &RingQueue<uint_t>::Create);
+  }
+  catch (const Error& err)
+  {
+    std::cout << "Failed: \n";
+    std::cerr << err.ToString();
+    return 1;
+  }
+}
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "async/executor.h"
 #include "async/job.h"
 
 namespace Async
@@ -37,5 +38,7 @@ namespace Async
     virtual void ExecuteCycle() = 0;
   };
 
+  //! @brief Executes worker with Priority::INTERACTIVE
   Job::Ptr CreateJob(Worker::Ptr worker);
+  Job::Ptr CreateJob(Priority prio, Worker::Ptr worker);
 }  // namespace Async
@@ -17,6 +17,8 @@
 
 #include "3rdparty/zlib/zlib.h"
 
+#include <algorithm>
+
 namespace Binary::Compression::Zlib
 {
   class Stream
@@ -60,6 +62,8 @@ namespace Binary::Compression::Zlib
 
   class DecompressStream : public Stream
   {
+    static constexpr std::size_t MAX_WINDOW = 1u << 30;
+
   public:
     DecompressStream() = default;
 
@@ -84,32 +88,47 @@ namespace Binary::Compression::Zlib
 
     void Decompress(DataInputStream& input, DataBuilder& output, std::size_t outputSizeHint)
     {
-      const auto prevOutSize = output.Size();
-
-      SetInput(View(input.PeekRawData(0), input.GetRestSize()));
+      // zlib counters are limited by uInt, so huge streams are processed in windows
+      const auto* const inData = static_cast<const uint8_t*>(input.PeekRawData(0));
+      const auto inSize = input.GetRestSize();
+      std::size_t inFed = 0;
+      const auto outStart = output.Size();
+      std::size_t outFilled = 0;
+      std::size_t outAllocated = 0;
       if (outputSizeHint != 0)
       {
-        SetOutput(output.Allocate(outputSizeHint), outputSizeHint);
+        output.Allocate(outputSizeHint);
+        outAllocated = outputSizeHint;
       }
       for (;;)
       {
-        if (Delegate.avail_out == 0)
+        if (Delegate.avail_in == 0 && inFed != inSize)
+        {
+          const auto chunk = std::min(inSize - inFed, MAX_WINDOW);
+          SetInput(View(inData + inFed, chunk));
+          inFed += chunk;
+        }
+        if (outFilled == outAllocated)
         {
-          const auto restInput = uint64_t(Delegate.avail_in);
-          const auto forecastOutput = Delegate.total_in ? restInput * Delegate.total_out / Delegate.total_in
-                                                        : restInput * 2;
-          const auto bufSize = Math::Align<std::size_t>(forecastOutput, 16384);
-          SetOutput(output.Allocate(bufSize), bufSize);
+          const auto inConsumed = inFed - Delegate.avail_in;
+          const auto restInput = uint64_t(inSize - inConsumed);
+          const auto forecastOutput = inConsumed ? restInput * outFilled / inConsumed : restInput * 2;
+          const auto bufSize = Math::Align<std::size_t>(std::max<uint64_t>(forecastOutput, 1), 16384);
+          output.Allocate(bufSize);
+          outAllocated += bufSize;
         }
+        const auto outChunk = std::min(outAllocated - outFilled, MAX_WINDOW);
+        SetOutput(output.Get(outStart + outFilled), outChunk);
         const auto res = ::inflate(&Delegate, Z_SYNC_FLUSH);
+        outFilled += outChunk - Delegate.avail_out;
         if (res == Z_STREAM_END)
         {
           break;
         }
         CheckError(res, THIS_LINE);
       }
-      input.Skip(Delegate.total_in);
-      output.Resize(prevOutSize + Delegate.total_out);
+      input.Skip(inFed - Delegate.avail_in);
+      output.Resize(outStart + outFilled);
     }
 
     std::size_t Decompress()
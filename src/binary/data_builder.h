@@ -21,14 +21,37 @@
 
 namespace Binary
 {
+  //! @brief Get buffer with at least specified capacity from thread-local pool of released ones
+  Dump AcquireBuffer(std::size_t reserve);
+  //! @brief Put buffer to thread-local pool for further reuse
+  void ReleaseBuffer(Dump buffer) noexcept;
+
   class DataBuilder
   {
   public:
     DataBuilder() = default;
 
+    //! @brief Preallocate storage, possibly reusing memory of discarded builders on the same thread
     explicit DataBuilder(std::size_t reserve)
+      : Content(AcquireBuffer(reserve))
+    {}
+
+    DataBuilder(const DataBuilder&) = delete;
+    DataBuilder(DataBuilder&&) noexcept = default;
+
+    DataBuilder& operator=(const DataBuilder&) = delete;
+
+    DataBuilder& operator=(DataBuilder&& rh) noexcept
+    {
+      ReleaseBuffer(std::move(Content));
+      Content = std::move(rh.Content);
+      return *this;
+    }
+
+    //! @brief Not captured content is cheaply discarded keeping allocated memory for subsequent builders
+    ~DataBuilder()
     {
-      Content.reserve(reserve);
+      ReleaseBuffer(std::move(Content));
     }
 
     template<class T, typename std::enable_if<!std::is_pointer<T>::value, int>::type = 0>
@@ -103,6 +126,13 @@ namespace Binary
 
     Container::Ptr CaptureResult()
     {
+      if (Content.capacity() / 2 > Content.size())
+      {
+        // do not waste memory of overestimated preallocation, keep it for reuse instead
+        auto result = CreateContainer(GetView());
+        Content.clear();
+        return result;
+      }
       return CreateContainer(std::make_unique<Dump>(std::move(Content)));
     }
 
@@ -15,6 +15,8 @@
 #include "make_ptr.h"
 #include "string_view.h"
 
+#include <mutex>
+
 namespace Binary
 {
   class MatchOnlyFormatBase : public Format
@@ -112,6 +114,36 @@ namespace Binary
       return FuzzyMatchOnlyFormat::Create(std::move(pattern), startOffset, minSize);
     }
   }
+
+  class DelayedCompiledMatchOnlyFormat : public MatchOnlyFormatBase
+  {
+  public:
+    DelayedCompiledMatchOnlyFormat(FormatDSL::Expression::Ptr expr, std::size_t minSize)
+      : MinSize(std::max(minSize, expr->StartOffset() + expr->Predicates().size()))
+      , Expr(std::move(expr))
+    {}
+
+    bool Match(View data) const override
+    {
+      return data.Size() >= MinSize && GetDelegate().Match(data);
+    }
+
+  private:
+    const Format& GetDelegate() const
+    {
+      std::call_once(Compiled, [this]() {
+        Delegate = CreateMatchingFormatFromPredicates(*Expr, MinSize);
+        Expr.reset();
+      });
+      return *Delegate;
+    }
+
+  private:
+    const std::size_t MinSize;
+    mutable FormatDSL::Expression::Ptr Expr;
+    mutable std::once_flag Compiled;
+    mutable Format::Ptr Delegate;
+  };
 }  // namespace Binary
 
 namespace Binary
@@ -123,7 +155,7 @@ namespace Binary
 
   Format::Ptr CreateMatchOnlyFormat(StringView pattern, std::size_t minSize)
   {
-    const auto expr = FormatDSL::Expression::Parse(pattern);
-    return CreateMatchingFormatFromPredicates(*expr, minSize);
+    auto expr = FormatDSL::Expression::Parse(pattern);
+    return MakePtr<DelayedCompiledMatchOnlyFormat>(std::move(expr), minSize);
   }
 }  // namespace Binary
@@ -21,6 +21,7 @@
 #include <array>
 #include <atomic>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 namespace Binary
@@ -373,6 +374,48 @@ namespace Binary
       return MakePtr<DelayedScanningFuzzyFormat>(std::move(pattern), startOffset, minSize);
     }
   }
+
+  // Most of the formats are never used in a session, so compilation is deferred up to the first call
+  class DelayedCompiledFormat : public FormatDetails
+  {
+  public:
+    DelayedCompiledFormat(FormatDSL::Expression::Ptr expr, std::size_t minSize)
+      : MinSize(std::max(minSize, expr->StartOffset() + expr->Predicates().size()))
+      , Expr(std::move(expr))
+    {}
+
+    bool Match(View data) const override
+    {
+      return data.Size() >= MinSize && GetDelegate().Match(data);
+    }
+
+    std::size_t NextMatchOffset(View data) const override
+    {
+      const std::size_t size = data.Size();
+      return size < MinSize ? size : GetDelegate().NextMatchOffset(data);
+    }
+
+    std::size_t GetMinSize() const override
+    {
+      return MinSize;
+    }
+
+  private:
+    const Format& GetDelegate() const
+    {
+      std::call_once(Compiled, [this]() {
+        Delegate = CreateScanningFormatFromPredicates(*Expr, MinSize);
+        Expr.reset();
+      });
+      return *Delegate;
+    }
+
+  private:
+    const std::size_t MinSize;
+    mutable FormatDSL::Expression::Ptr Expr;
+    mutable std::once_flag Compiled;
+    mutable Format::Ptr Delegate;
+  };
 }  // namespace Binary
 
 namespace Binary
@@ -384,7 +427,7 @@ namespace Binary
 
   Format::Ptr CreateFormat(StringView pattern, std::size_t minSize)
   {
-    const auto expr = FormatDSL::Expression::Parse(pattern);
-    return CreateScanningFormatFromPredicates(*expr, minSize);
+    auto expr = FormatDSL::Expression::Parse(pattern);
+    return MakePtr<DelayedCompiledFormat>(std::move(expr), minSize);
   }
 }  // namespace Binary
@@ -14,6 +14,7 @@
 
 #include "contract.h"
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -112,10 +113,22 @@ namespace Binary::FormatDSL
   public:
     explicit StaticPattern(std::span<const Predicate* const> pat)
     {
+      // quantors expand to the same predicate instance repeated, so evaluate each distinct one only once
+      std::vector<std::pair<const Predicate*, std::size_t>> evaluated;
       Data.reserve(pat.size());
-      for (const auto& pred : pat)
+      for (const auto* pred : pat)
       {
-        Data.emplace_back(*pred);
+        const auto it = std::find_if(evaluated.begin(), evaluated.end(),
+                                     [pred](const auto& entry) { return entry.first == pred; });
+        if (it != evaluated.end())
+        {
+          Data.push_back(Data[it->second]);
+        }
+        else
+        {
+          evaluated.emplace_back(pred, Data.size());
+          Data.emplace_back(*pred);
+        }
       }
     }
 
@@ -0,0 +1,96 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Data builder buffers pool implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "binary/data_builder.h"
+
+#include <algorithm>
+
+namespace Binary
+{
+  // Speculative decoding (e.g. raw scanning) creates and discards a lot of builders with similar sizes.
+  // Keep few released buffers per thread to avoid heap traffic. Total size is limited since pools live as long as
+  // their threads do.
+  class BuffersPool
+  {
+  public:
+    BuffersPool()
+    {
+      // avoid allocations on release
+      Buffers.reserve(MAX_BUFFERS + 1);
+    }
+
+    Dump Acquire(std::size_t reserve)
+    {
+      Dump result;
+      if (!Buffers.empty())
+      {
+        // prefer the smallest sufficient one
+        auto it = std::find_if(Buffers.begin(), Buffers.end(),
+                               [reserve](const Dump& buf) { return buf.capacity() >= reserve; });
+        if (it == Buffers.end())
+        {
+          it = std::prev(Buffers.end());
+        }
+        result = std::move(*it);
+        Buffers.erase(it);
+        TotalSize -= result.capacity();
+      }
+      result.reserve(reserve);
+      return result;
+    }
+
+    void Release(Dump buffer) noexcept
+    {
+      const auto capacity = buffer.capacity();
+      if (capacity == 0 || capacity > MAX_BUFFER_SIZE)
+      {
+        return;
+      }
+      buffer.clear();
+      const auto pos = std::lower_bound(Buffers.begin(), Buffers.end(), capacity,
+                                        [](const Dump& buf, std::size_t cap) { return buf.capacity() < cap; });
+      Buffers.insert(pos, std::move(buffer));
+      TotalSize += capacity;
+      while (Buffers.size() > MAX_BUFFERS || TotalSize > MAX_TOTAL_SIZE)
+      {
+        // drop the smallest one
+        TotalSize -= Buffers.front().capacity();
+        Buffers.erase(Buffers.begin());
+      }
+    }
+
+    static BuffersPool& Instance()
+    {
+      static thread_local BuffersPool instance;
+      return instance;
+    }
+
+  private:
+    static const std::size_t MAX_BUFFERS = 4;
+    static const std::size_t MAX_BUFFER_SIZE = 1 << 20;
+    static const std::size_t MAX_TOTAL_SIZE = 2 << 20;
+    // sorted by capacity
+    std::vector<Dump> Buffers;
+    std::size_t TotalSize = 0;
+  };
+
+  Dump AcquireBuffer(std::size_t reserve)
+  {
+    return BuffersPool::Instance().Acquire(reserve);
+  }
+
+  void ReleaseBuffer(Dump buffer) noexcept
+  {
+    if (buffer.capacity())
+    {
+      BuffersPool::Instance().Release(std::move(buffer));
+    }
+  }
+}  // namespace Binary
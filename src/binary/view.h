@@ -34,8 +34,8 @@ namespace Binary
       , Length(Begin ? size : 0)
     {}
 
-    template<class T, std::enable_if_t<is_applicable_for_view<T>, int> = 0>
-    View(const std::vector<T>& data)
+    template<class T, class Allocator, std::enable_if_t<is_applicable_for_view<T>, int> = 0>
+    View(const std::vector<T, Allocator>& data)
       : View(data.data(), data.size() * sizeof(T))
     {}
 
@@ -13,7 +13,10 @@
 #include "core/plugins/archives/l10n.h"
 
 #include "core/plugin_attrs.h"
+#include "core/plugins_parameters.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
+#include "formats/archived/prefetch.h"
 #include "module/attributes.h"
 #include "strings/format.h"
 #include "tools/progress_callback.h"
@@ -24,6 +27,14 @@
 namespace ZXTune
 {
   const Debug::Stream ArchivedDbg("Core::ArchivesSupp");
+  static auto& OpenTime = Metrics::GetHistogram("core.archives.open_ns");
+
+  Formats::Archived::Container::Ptr OpenArchive(const Formats::Archived::Decoder& decoder,
+                                                const Binary::Container& data)
+  {
+    const Metrics::ScopedTimer timer(OpenTime);
+    return decoder.Decode(data);
+  }
 
   class LoggerHelper
   {
@@ -127,16 +138,19 @@ namespace ZXTune
       return Decoder->GetFormat();
     }
 
-    Analysis::Result::Ptr Detect(const Parameters::Accessor& /*params*/, DataLocation::Ptr input,
+    Analysis::Result::Ptr Detect(const Parameters::Accessor& params, DataLocation::Ptr input,
                                  ArchiveCallback& callback) const override
     {
       const auto rawData = input->GetData();
-      if (const auto archive = Decoder->Decode(*rawData))
+      if (const auto archive = OpenArchive(*Decoder, *rawData))
       {
         if (const auto count = archive->CountFiles())
         {
           const ContainerDetectCallback detect(~std::size_t(0), Identifier, input, count, callback);
-          archive->ExploreFiles(detect);
+          using namespace Parameters::ZXTune::Core::Plugins;
+          const auto threads = Parameters::GetInteger<uint_t>(params, PREFETCH_THREADS);
+          const auto prefetchSize = Parameters::GetInteger<std::size_t>(params, PREFETCH_SIZE, PREFETCH_SIZE_DEFAULT);
+          Formats::Archived::ExploreFilesPrefetched(*archive, detect, threads, prefetchSize);
         }
         return Analysis::CreateMatchedResult(archive->Size());
       }
@@ -147,7 +161,7 @@ namespace ZXTune
                               const Analysis::Path& inPath) const override
     {
       const auto rawData = location->GetData();
-      if (const auto archive = Decoder->Decode(*rawData))
+      if (const auto archive = OpenArchive(*Decoder, *rawData))
       {
         if (const auto fileToOpen = FindFile(*archive, inPath))
         {
@@ -11,6 +11,7 @@
 #include "core/plugins/archives/packed.h"
 
 #include "core/plugin_attrs.h"
+#include "debug/metrics.h"
 
 #include "make_ptr.h"
 #include "string_view.h"
@@ -37,6 +38,14 @@ namespace ZXTune
     return IsArchivePluginPathComponent(component) ? component.substr(ARCHIVE_PLUGIN_PREFIX.size()) : StringView{};
   }
 
+  static auto& DepackTime = Metrics::GetHistogram("core.archives.depack_ns");
+
+  Formats::Packed::Container::Ptr Depack(const Formats::Packed::Decoder& decoder, const Binary::Container& data)
+  {
+    const Metrics::ScopedTimer timer(DepackTime);
+    return decoder.Decode(data);
+  }
+
   class CommonArchivePlugin : public ArchivePlugin
   {
   public:
@@ -70,7 +79,7 @@ namespace ZXTune
                                  ArchiveCallback& callback) const override
     {
       auto rawData = inputData->GetData();
-      if (auto subData = Decoder->Decode(*rawData))
+      if (auto subData = Depack(*Decoder, *rawData))
       {
         const auto packedSize = subData->PackedSize();
         auto subPath = EncodeArchivePluginToPath(Identifier);
@@ -92,7 +101,7 @@ namespace ZXTune
         return {};
       }
       const auto rawData = inputData->GetData();
-      if (auto subData = Decoder->Decode(*rawData))
+      if (auto subData = Depack(*Decoder, *rawData))
       {
         return CreateNestedLocation(std::move(inputData), std::move(subData), Identifier, pathComponent);
       }
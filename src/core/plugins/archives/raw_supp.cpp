@@ -15,6 +15,7 @@
 #include "core/plugins/archives/l10n.h"
 #include "core/plugins/players/plugin.h"
 
+#include "async/executor.h"
 #include "binary/container.h"
 #include "core/plugin_attrs.h"
 #include "core/plugins_parameters.h"
@@ -33,8 +34,15 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <list>
 #include <map>
+#include <mutex>
+#include <thread>
 
 namespace ZXTune
 {
@@ -105,11 +113,16 @@ namespace ZXTune
     using TimeUnit = Time::Timer::NativeUnit;
 
   public:
-    Statistic() = default;
+    Statistic()
+      : Dbg("Core::RawScaner::Statistic")
+    {}
 
     ~Statistic()
     {
-      const Debug::Stream Dbg("Core::RawScaner::Statistic");
+      if (!Dbg.IsEnabled() || !TotalData)
+      {
+        return;
+      }
       const auto spent = Timer.Elapsed();
       Dbg("Total processed: {}", TotalData);
       Dbg("Time spent: {}", Time::ToString(spent));
@@ -132,22 +145,42 @@ namespace ZXTune
 
     void Enqueue(std::size_t size)
     {
+      if (!Dbg.IsEnabled())
+      {
+        return;
+      }
+      const std::scoped_lock lock(Guard);
       TotalData += size;
     }
 
     void AddArchived(std::size_t size)
     {
+      if (!Dbg.IsEnabled())
+      {
+        return;
+      }
+      const std::scoped_lock lock(Guard);
       ArchivedData += size;
     }
 
     void AddModule(std::size_t size)
     {
+      if (!Dbg.IsEnabled())
+      {
+        return;
+      }
+      const std::scoped_lock lock(Guard);
       ModulesData += size;
     }
 
     template<class PluginType>
     void AddAimed(const PluginType& plug, const Time::Timer& scanTimer)
     {
+      if (!Dbg.IsEnabled())
+      {
+        return;
+      }
+      const std::scoped_lock lock(Guard);
       StatItem& item = GetStat(plug);
       ++item.Aimed;
       item.AimedTime += scanTimer.Elapsed() + item.ScanTime;
@@ -157,6 +190,11 @@ namespace ZXTune
     template<class PluginType>
     void AddMissed(const PluginType& plug, const Time::Timer& scanTimer)
     {
+      if (!Dbg.IsEnabled())
+      {
+        return;
+      }
+      const std::scoped_lock lock(Guard);
       StatItem& item = GetStat(plug);
       ++item.Missed;
       item.MissedTime += scanTimer.Elapsed() + item.ScanTime;
@@ -166,6 +204,11 @@ namespace ZXTune
     template<class PluginType>
     void AddScanned(const PluginType& plug, const Time::Timer& scanTimer)
     {
+      if (!Dbg.IsEnabled())
+      {
+        return;
+      }
+      const std::scoped_lock lock(Guard);
       StatItem& item = GetStat(plug);
       item.ScanTime += scanTimer.Elapsed();
     }
@@ -251,7 +294,10 @@ namespace ZXTune
     }
 
   private:
+    // collected only for debug output, so parallel scans do not contend for it otherwise
+    const Debug::Stream Dbg;
     const Time::Timer Timer;
+    std::mutex Guard;
     uint64_t TotalData = 0;
     uint64_t ArchivedData = 0;
     uint64_t ModulesData = 0;
@@ -272,6 +318,9 @@ namespace ZXTune::Raw
 
   const std::size_t SCAN_STEP = 1;
   const std::size_t MIN_MINIMAL_RAW_SIZE = 128;
+  // Lookahead search is limited by scanned range plus this overlap. Should cover the longest format span (e.g. Z80
+  // snapshot header to footer)
+  const std::size_t LOOKAHEAD_OVERLAP = 65536;
 
   String CreateFilename(std::size_t offset)
   {
@@ -303,6 +352,12 @@ namespace ZXTune::Raw
       return 0 != Parameters::GetInteger(Accessor, Parameters::ZXTune::Core::Plugins::Raw::PLAIN_DOUBLE_ANALYSIS);
     }
 
+    std::size_t GetParallelWindow() const
+    {
+      using namespace Parameters::ZXTune::Core::Plugins::Raw;
+      return Parameters::GetInteger<std::size_t>(Accessor, PARALLEL_WINDOW, PARALLEL_WINDOW_DEFAULT);
+    }
+
   private:
     const Parameters::Accessor& Accessor;
   };
@@ -494,8 +549,9 @@ namespace ZXTune::Raw
       typename P::Ptr Plugin;
       std::size_t Offset = 0;
 
-      explicit PluginEntry(typename P::Ptr plugin)
+      PluginEntry(typename P::Ptr plugin, std::size_t offset)
         : Plugin(std::move(plugin))
+        , Offset(offset)
       {}
 
       PluginEntry() = default;
@@ -554,13 +610,14 @@ namespace ZXTune::Raw
     };
 
     template<class Container>
-    explicit LookaheadPluginsStorage(const Container& plugins)
+    LookaheadPluginsStorage(const Container& plugins, std::size_t start)
+      : Offset(start)
     {
       for (const auto& plugin : plugins)
       {
         if (plugin->Capabilities() != CAPS)
         {
-          Plugins.emplace_back(PluginEntry(plugin));
+          Plugins.emplace_back(PluginEntry(plugin, start));
         }
         else
         {
@@ -587,6 +644,22 @@ namespace ZXTune::Raw
       Offset = offset;
     }
 
+    // Emulates state of scan continued from previous offset: plugins are disabled up to the next format match. Some
+    // formats never match beyond the data start, so such plugins are not checked at all
+    void Resume(Binary::View data, std::size_t lookaheadEnd)
+    {
+      assert(Offset != 0);
+      const auto prevOffset = Offset - 1;
+      const auto view = data.SubView(prevOffset, lookaheadEnd - prevOffset);
+      for (auto& entry : Plugins)
+      {
+        if (const auto format = entry.Plugin->GetFormat())
+        {
+          entry.Offset = prevOffset + format->NextMatchOffset(view);
+        }
+      }
+    }
+
   private:
     std::size_t Offset = 0;
     PluginsList Plugins;
@@ -671,12 +744,21 @@ namespace ZXTune::Raw
   class RawDetectionPlugins
   {
   public:
-    RawDetectionPlugins(const Parameters::Accessor& params, bool plainArchivesDoubleAnalysis)
+    RawDetectionPlugins(const Parameters::Accessor& params, bool plainArchivesDoubleAnalysis, std::size_t start,
+                        std::size_t lookaheadEnd)
       : Params(params)
-      , Players(PlayerPlugin::Enumerate())
-      , Archives(plainArchivesDoubleAnalysis ? DoubleAnalyzedArchives::GetPlugins() : ArchivePlugin::Enumerate())
+      , Players(PlayerPlugin::Enumerate(), start)
+      , Archives(plainArchivesDoubleAnalysis ? DoubleAnalyzedArchives::GetPlugins() : ArchivePlugin::Enumerate(), start)
+      , LookaheadEnd(lookaheadEnd)
+      , Offset(start)
     {}
 
+    void Resume(Binary::View data)
+    {
+      Players.Resume(data, LookaheadEnd);
+      Archives.Resume(data, LookaheadEnd);
+    }
+
     std::pair<std::size_t, bool> Detect(DataLocation::Ptr input, ArchiveCallback& callback)
     {
       const auto detectedModules = DetectIn(Players, input, callback);
@@ -727,7 +809,7 @@ namespace ZXTune::Raw
         {
           Statistic::Self().AddMissed(plugin, detectTimer);
           const Time::Timer scanTimer;
-          const std::size_t lookahead = result->GetLookaheadOffset();
+          const std::size_t lookahead = result->GetLookaheadOffset(LookaheadEnd - Offset);
           iter.SetLookahead(lookahead);
           Dbg("Disabling check of {} for neareast {} bytes starting from {}", id, lookahead, Offset);
           if (lookahead == maxSize)
@@ -748,9 +830,380 @@ namespace ZXTune::Raw
     const Parameters::Accessor& Params;
     LookaheadPluginsStorage<PlayerPlugin> Players;
     LookaheadPluginsStorage<ArchivePlugin> Archives;
+    const std::size_t LookaheadEnd;
     std::size_t Offset = 0;
   };
 
+  class CapturedDataLocation : public DataLocation
+  {
+  public:
+    explicit CapturedDataLocation(const DataLocation& location)
+      : Data(location.GetData())
+      , Path(location.GetPath())
+      , PluginsChain(location.GetPluginsChain())
+    {}
+
+    Binary::Container::Ptr GetData() const override
+    {
+      return Data;
+    }
+
+    Analysis::Path::Ptr GetPath() const override
+    {
+      return Path;
+    }
+
+    Analysis::Path::Ptr GetPluginsChain() const override
+    {
+      return PluginsChain;
+    }
+
+  private:
+    const Binary::Container::Ptr Data;
+    const Analysis::Path::Ptr Path;
+    const Analysis::Path::Ptr PluginsChain;
+  };
+
+  // Stores callbacks made by plugins to replay them later in proper order
+  class RecordedCallback : public ArchiveCallback
+  {
+  public:
+    RecordedCallback(const ArchiveCallback& delegate, Log::ProgressCallback* progress)
+      : Delegate(&delegate)
+      , Progress(progress)
+    {}
+
+    Parameters::Container::Ptr CreateInitialProperties(StringView subpath) const override
+    {
+      return Delegate->CreateInitialProperties(subpath);
+    }
+
+    void ProcessModule(const DataLocation& location, const Plugin& decoder, Module::Holder::Ptr holder) override
+    {
+      auto captured = MakePtr<CapturedDataLocation>(location);
+      Calls.emplace_back([captured = std::move(captured), &decoder, holder = std::move(holder)](ArchiveCallback& cb) {
+        cb.ProcessModule(*captured, decoder, holder);
+      });
+    }
+
+    void ProcessUnknownData(const DataLocation& location) override
+    {
+      auto captured = MakePtr<CapturedDataLocation>(location);
+      Calls.emplace_back([captured = std::move(captured)](ArchiveCallback& cb) { cb.ProcessUnknownData(*captured); });
+    }
+
+    Log::ProgressCallback* GetProgress() const override
+    {
+      return Progress;
+    }
+
+    void ProcessData(DataLocation::Ptr data) override
+    {
+      Calls.emplace_back([data = std::move(data)](ArchiveCallback& cb) { cb.ProcessData(data); });
+    }
+
+    bool IsEmpty() const
+    {
+      return Calls.empty();
+    }
+
+    void Replay(ArchiveCallback& target) const
+    {
+      for (const auto& call : Calls)
+      {
+        call(target);
+      }
+    }
+
+  private:
+    const ArchiveCallback* Delegate;
+    Log::ProgressCallback* Progress;
+    std::vector<std::function<void(ArchiveCallback&)>> Calls;
+  };
+
+  // Result of detection at single scan position
+  struct ScanStep
+  {
+    ScanStep(std::size_t offset, const ArchiveCallback& callback, Log::ProgressCallback* progress)
+      : Offset(offset)
+      , Calls(callback, progress)
+    {}
+
+    std::size_t Offset;
+    std::size_t Next = 0;
+    bool Matched = false;
+    RecordedCallback Calls;
+  };
+
+  class RangeScaner
+  {
+  public:
+    RangeScaner(const Parameters::Accessor& params, bool doubleAnalysis, DataLocation::Ptr input,
+                std::size_t minRawSize, const ArchiveCallback& callback)
+      : Params(params)
+      , DoubleAnalysis(doubleAnalysis)
+      , Input(std::move(input))
+      , MinRawSize(minRawSize)
+      , Callback(callback)
+    {}
+
+    // Scans data in [start, end) range until stop(offset) is true. Detected data may go beyond the range. Every scan
+    // step is passed to sink. Returns offset where scan is stopped at.
+    template<class StopPredicate, class Sink>
+    std::size_t Scan(std::size_t start, std::size_t end, Log::ProgressCallback* progress, StopPredicate&& stop,
+                     Sink&& sink) const
+    {
+      RawDetectionPlugins usedPlugins(Params, DoubleAnalysis, start, end + LOOKAHEAD_OVERLAP);
+      if (start != 0)
+      {
+        usedPlugins.Resume(*Input->GetData());
+      }
+      auto subLocation = MakePtr<ScanDataLocation>(Input, start);
+      while (subLocation->HasToScan(MinRawSize))
+      {
+        const std::size_t offset = subLocation->GetOffset();
+        if (offset >= end || stop(offset))
+        {
+          return offset;
+        }
+        usedPlugins.SetOffset(offset);
+        ScanStep step(offset, Callback, progress);
+        const auto detectResult = usedPlugins.Detect(subLocation, step.Calls);
+        if (!subLocation.unique())
+        {
+          Dbg("Sublocation is captured. Duplicate.");
+          subLocation = MakePtr<ScanDataLocation>(Input, offset);
+        }
+        // lookahead is not reliable outside of range
+        const auto skip = detectResult.second ? detectResult.first : std::min(detectResult.first, end - offset);
+        subLocation->Move(std::max(skip, SCAN_STEP));
+        step.Next = subLocation->GetOffset();
+        step.Matched = detectResult.second;
+        sink(std::move(step));
+      }
+      return subLocation->GetOffset();
+    }
+
+  private:
+    const Parameters::Accessor& Params;
+    const bool DoubleAnalysis;
+    const DataLocation::Ptr Input;
+    const std::size_t MinRawSize;
+    const ArchiveCallback& Callback;
+  };
+
+  // Passes scan results to callback in order of serial scan
+  class ScanResults
+  {
+  public:
+    ScanResults(DataLocation::Ptr input, ArchiveCallback& callback)
+      : Input(std::move(input))
+      , Callback(callback)
+    {}
+
+    void Add(const ScanStep& step)
+    {
+      step.Calls.Replay(Callback);
+      if (step.Matched)
+      {
+        if (LastUsedEnd != step.Offset)
+        {
+          Callback.ProcessUnknownData(UnknownDataLocation(Input, LastUsedEnd, step.Offset));
+        }
+        LastUsedEnd = step.Next;
+      }
+    }
+
+    void Finish(std::size_t size)
+    {
+      if (LastUsedEnd != size)
+      {
+        Callback.ProcessUnknownData(UnknownDataLocation(std::move(Input), LastUsedEnd, size));
+      }
+    }
+
+  private:
+    DataLocation::Ptr Input;
+    ArchiveCallback& Callback;
+    std::size_t LastUsedEnd = 0;
+  };
+
+  /*
+    Part of data scanned independently starting from its beginning. Each scan position depends on previous detections,
+    so serial scan may enter the window at another offset than window's scan did. Both scans are equal starting from
+    the first offset not covered by window's detections.
+  */
+  class ScanWindow
+  {
+  public:
+    using Ptr = std::shared_ptr<ScanWindow>;
+
+    ScanWindow(const RangeScaner& scaner, const std::atomic<bool>& cancelled, std::size_t start, std::size_t end)
+      : Scaner(scaner)
+      , Cancelled(cancelled)
+      , Start(start)
+      , End(end)
+    {}
+
+    // Performs scan if not yet started by anybody else
+    void Process()
+    {
+      if (Claimed.exchange(true))
+      {
+        return;
+      }
+      try
+      {
+        Stop = Scaner.Scan(
+            Start, End, nullptr, [this](std::size_t) { return Cancelled.load(); },
+            [this](ScanStep&& step) {
+              if (step.Matched || !step.Calls.IsEmpty())
+              {
+                Steps.emplace_back(std::move(step));
+              }
+            });
+      }
+      catch (...)
+      {
+        Error = std::current_exception();
+      }
+      const std::scoped_lock lock(Guard);
+      Done = true;
+      Finished.notify_all();
+    }
+
+    // Processes in current thread if required and waits for result
+    void Complete()
+    {
+      Process();
+      std::unique_lock lock(Guard);
+      Finished.wait(lock, [this]() { return Done; });
+      if (Error)
+      {
+        std::rethrow_exception(Error);
+      }
+    }
+
+    // Prevents processing if not started yet or waits for completion
+    void Cancel()
+    {
+      if (Claimed.exchange(true))
+      {
+        std::unique_lock lock(Guard);
+        Finished.wait(lock, [this]() { return Done; });
+      }
+    }
+
+    std::size_t GetStart() const
+    {
+      return Start;
+    }
+
+    std::size_t GetStop() const
+    {
+      return Stop;
+    }
+
+    bool IsSynchronized(std::size_t offset) const
+    {
+      const auto it = std::partition_point(Steps.begin(), Steps.end(),
+                                           [offset](const ScanStep& step) { return step.Offset < offset; });
+      return it == Steps.begin() || !std::prev(it)->Matched || std::prev(it)->Next <= offset;
+    }
+
+    void ReportFrom(std::size_t offset, ScanResults& results) const
+    {
+      const auto it = std::partition_point(Steps.begin(), Steps.end(),
+                                           [offset](const ScanStep& step) { return step.Offset < offset; });
+      std::for_each(it, Steps.end(), [&results](const ScanStep& step) { results.Add(step); });
+    }
+
+  private:
+    // accessed only when processing, so never used after owner is gone
+    const RangeScaner& Scaner;
+    const std::atomic<bool>& Cancelled;
+    const std::size_t Start;
+    const std::size_t End;
+    std::atomic<bool> Claimed{false};
+    std::mutex Guard;
+    std::condition_variable Finished;
+    bool Done = false;
+    std::size_t Stop = 0;
+    std::vector<ScanStep> Steps;
+    std::exception_ptr Error;
+  };
+
+  class ParallelScan
+  {
+  public:
+    ParallelScan(const RangeScaner& scaner, std::size_t size, std::size_t minRawSize, std::size_t window)
+      : Scaner(scaner)
+      , Size(size)
+      , MinRawSize(minRawSize)
+      , Window(window)
+      , MaxPending(2 * std::max<std::size_t>(1, std::thread::hardware_concurrency()))
+    {}
+
+    ~ParallelScan()
+    {
+      Cancelled = true;
+      for (const auto& window : Pending)
+      {
+        window->Cancel();
+      }
+    }
+
+    void Run(ScanProgress& progress, ScanResults& results)
+    {
+      Fill();
+      std::size_t offset = 0;
+      while (!Pending.empty())
+      {
+        const auto window = Pending.front();
+        progress.Report(window->GetStart());
+        window->Complete();
+        Pending.pop_front();
+        Fill();
+        const auto stop = window->GetStop();
+        if (offset < stop && !window->IsSynchronized(offset))
+        {
+          Dbg("Resync at {}", offset);
+          offset = Scaner.Scan(
+              offset, stop, nullptr, [&window](std::size_t pos) { return window->IsSynchronized(pos); },
+              [&results](ScanStep&& step) { results.Add(step); });
+        }
+        if (offset < stop)
+        {
+          window->ReportFrom(offset, results);
+          offset = stop;
+        }
+      }
+    }
+
+  private:
+    void Fill()
+    {
+      while (Pending.size() < MaxPending && NextStart + MinRawSize <= Size)
+      {
+        const auto start = NextStart;
+        NextStart += Window;
+        auto window = MakePtr<ScanWindow>(Scaner, Cancelled, start, NextStart);
+        Async::Executor::Instance().Submit(Async::Priority::BACKGROUND, [window]() { window->Process(); });
+        Pending.push_back(std::move(window));
+      }
+    }
+
+  private:
+    const RangeScaner& Scaner;
+    const std::size_t Size;
+    const std::size_t MinRawSize;
+    const std::size_t Window;
+    const std::size_t MaxPending;
+    std::atomic<bool> Cancelled{false};
+    std::size_t NextStart = 0;
+    std::deque<ScanWindow::Ptr> Pending;
+  };
+
   class Scaner : public ArchivePlugin
   {
   public:
@@ -790,41 +1243,30 @@ namespace ZXTune::Raw
 
       const PluginParameters scanParams(params);
       const std::size_t minRawSize = scanParams.GetMinimalSize();
+      const std::size_t window = scanParams.GetParallelWindow();
 
       const String currentPath = input->GetPath()->AsString();
       Dbg("Detecting modules in raw data at '{}'", currentPath);
       ScanProgress progress(callback.GetProgress(), size, currentPath);
 
-      RawDetectionPlugins usedPlugins(params, scanParams.GetDoubleAnalysis());
-
-      auto subLocation = MakePtr<ScanDataLocation>(input, 0);
-
-      std::size_t lastUsedEnd = 0;
-      while (subLocation->HasToScan(minRawSize))
+      const RangeScaner scaner(params, scanParams.GetDoubleAnalysis(), input, minRawSize, callback);
+      ScanResults results(input, callback);
+      if (window != 0 && size >= 2 * window)
       {
-        const std::size_t offset = subLocation->GetOffset();
-        progress.Report(offset);
-        usedPlugins.SetOffset(offset);
-        const auto detectResult = usedPlugins.Detect(subLocation, callback);
-        if (!subLocation.unique())
-        {
-          Dbg("Sublocation is captured. Duplicate.");
-          subLocation = MakePtr<ScanDataLocation>(input, offset);
-        }
-        subLocation->Move(std::max(detectResult.first, SCAN_STEP));
-        if (detectResult.second)
-        {
-          if (lastUsedEnd != offset)
-          {
-            callback.ProcessUnknownData(UnknownDataLocation(input, lastUsedEnd, offset));
-          }
-          lastUsedEnd = subLocation->GetOffset();
-        }
+        Dbg("Scan concurrently by {} bytes", window);
+        ParallelScan(scaner, size, minRawSize, window).Run(progress, results);
       }
-      if (lastUsedEnd != size)
+      else
       {
-        callback.ProcessUnknownData(UnknownDataLocation(std::move(input), lastUsedEnd, size));
+        scaner.Scan(
+            0, size, callback.GetProgress(),
+            [&progress](std::size_t offset) {
+              progress.Report(offset);
+              return false;
+            },
+            [&results](ScanStep&& step) { results.Add(step); });
       }
+      results.Finish(size);
       return Analysis::CreateMatchedResult(size);
     }
 
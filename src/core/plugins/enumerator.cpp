@@ -15,6 +15,7 @@
 #include "core/src/l10n.h"
 
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "time/timer.h"
 
 #include "error_tools.h"
@@ -24,6 +25,7 @@
 namespace ZXTune
 {
   const Debug::Stream EnumeratorDbg("Core::Enumerator");
+  static auto& RegisterTime = Metrics::GetHistogram("core.plugins.register_ns");
 
   class AllPlugins
     : private ArchivePluginsRegistrator
@@ -57,6 +59,7 @@ namespace ZXTune
       Archives.reserve(128);
       Players.reserve(256);
       const Time::Timer timer;
+      const Metrics::ScopedTimer metric(RegisterTime);
       ZXTune::RegisterArchivePlugins(*this);
       ZXTune::RegisterPlayerPlugins(*this, *this);
       EnumeratorDbg("Registered {} archives and {} players for {}ms", Archives.size(), Players.size(),
@@ -25,6 +25,7 @@
 #include "core/core_parameters.h"
 #include "core/plugin_attrs.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "math/numeric.h"
 #include "module/attributes.h"
 #include "parameters/tracking_helper.h"
@@ -50,6 +51,8 @@ namespace Module::GME
 {
   const Debug::Stream Dbg("Core::GMESupp");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.gme.seek_ns");
+
   using EmuPtr = std::unique_ptr< ::Music_Emu>;
 
   using EmuCreator = EmuPtr (*)();
@@ -156,7 +159,8 @@ namespace Module::GME
 
     void Skip(uint_t samples)
     {
-      CheckError(Emu->skip(samples));
+      // long skips are performed with all the voices muted by emulator itself
+      CheckError(Emu->skip(static_cast<int>(samples * Sound::Sample::CHANNELS)));
     }
 
     void SetChannelsMask(int mask)
@@ -243,6 +247,7 @@ namespace Module::GME
 
     void SeekTune(Time::AtMillisecond request)
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine.Reset();
@@ -10,6 +10,8 @@
 
 #include "core/plugins/players/multi/multi_base.h"
 
+#include "async/executor.h"
+#include "core/plugins_parameters.h"
 #include "parameters/merged_accessor.h"
 #include "parameters/visitor.h"
 
@@ -17,6 +19,11 @@
 #include "make_ptr.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <type_traits>
 
 namespace Module
 {
@@ -38,7 +45,9 @@ namespace Module
       Right += rh.Right();
     }
 
-    Sound::Sample Convert(int_t divisor) const
+    // compile-time divisor allows to replace division by multiplication and vectorize the loop
+    template<class Divisor>
+    Sound::Sample Convert(Divisor divisor) const
     {
       static_assert(Sound::Sample::MID == 0, "Sound samples should be signed");
       return {Left / divisor, Right / divisor};
@@ -94,10 +103,25 @@ namespace Module
       if (const auto avail = *std::min_element(Portions.begin(), Portions.end()))
       {
         Sound::Chunk result(avail);
-        if (const uint_t divisor = DoneStreams)
+        switch (const int_t divisor = DoneStreams)
         {
-          std::transform(Buffer.begin(), Buffer.begin() + avail, result.begin(),
-                         [divisor](WideSample in) { return in.Convert(divisor); });
+        case 0:
+          break;
+        case 1:
+          ConvertTo(result, std::integral_constant<int_t, 1>());
+          break;
+        case 2:
+          ConvertTo(result, std::integral_constant<int_t, 2>());
+          break;
+        case 3:
+          ConvertTo(result, std::integral_constant<int_t, 3>());
+          break;
+        case 4:
+          ConvertTo(result, std::integral_constant<int_t, 4>());
+          break;
+        default:
+          ConvertTo(result, divisor);
+          break;
         }
         Consume(avail);
         DoneStreams = 0;
@@ -107,6 +131,13 @@ namespace Module
     }
 
   private:
+    template<class Divisor>
+    void ConvertTo(Sound::Chunk& result, Divisor divisor) const
+    {
+      std::transform(Buffer.begin(), Buffer.begin() + result.size(), result.begin(),
+                     [divisor](WideSample in) { return in.Convert(divisor); });
+    }
+
     void Consume(std::size_t size)
     {
       for (auto& done : Portions)
@@ -130,12 +161,85 @@ namespace Module
     uint_t DoneStreams = 0;
   };
 
+  // Runs tasks on the shared workers and waits for their completion
+  class ForkJoin
+  {
+  public:
+    ForkJoin() = default;
+    ForkJoin(const ForkJoin&) = delete;
+    ForkJoin& operator=(const ForkJoin&) = delete;
+
+    ~ForkJoin()
+    {
+      Wait();
+    }
+
+    void Fork(std::function<void()> task)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        ++Pending;
+      }
+      Async::Executor::Instance().Submit(Async::Priority::REALTIME, [this, task = std::move(task)]() {
+        Execute(task);
+        const std::lock_guard<std::mutex> lock(Guard);
+        if (--Pending == 0)
+        {
+          Done.notify_all();
+        }
+      });
+    }
+
+    //! Run task on the calling thread
+    void Execute(const std::function<void()>& task)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        if (!Failure)
+        {
+          Failure = std::current_exception();
+        }
+      }
+    }
+
+    //! Waits for all the forked tasks and rethrows the first failure
+    void Join()
+    {
+      Wait();
+      if (auto failure = std::move(Failure))
+      {
+        Failure = nullptr;
+        std::rethrow_exception(failure);
+      }
+    }
+
+  private:
+    void Wait()
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      Done.wait(lock, [this]() { return Pending == 0; });
+    }
+
+  private:
+    std::mutex Guard;
+    std::condition_variable Done;
+    std::size_t Pending = 0;
+    std::exception_ptr Failure;
+  };
+
   class MultiRenderer : public Renderer
   {
   public:
-    explicit MultiRenderer(RenderersArray delegates)
+    MultiRenderer(RenderersArray delegates, bool parallel)
       : Delegates(std::move(delegates))
       , Target(Delegates.size())
+      , Parallel(parallel)
+      , Rendered(Parallel ? Delegates.size() : 0)
     {}
 
     State::Ptr GetState() const override
@@ -145,12 +249,19 @@ namespace Module
 
     Sound::Chunk Render() override
     {
-      for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
+      if (Parallel)
       {
-        if (Target.NeedStream(idx))
+        RenderParallel();
+      }
+      else
+      {
+        for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
         {
-          auto data = Delegates[idx]->Render();
-          Target.MixStream(idx, data);
+          if (Target.NeedStream(idx))
+          {
+            auto data = Delegates[idx]->Render();
+            Target.MixStream(idx, data);
+          }
         }
       }
       return Target.Convert();
@@ -185,12 +296,44 @@ namespace Module
         delegates[idx] =
             holder->CreateRenderer(samplerate, Parameters::CreateMergedAccessor(holder->GetModuleProperties(), params));
       }
-      return MakePtr<MultiRenderer>(std::move(delegates));
+      const auto parallel =
+          0 != Parameters::GetInteger(*params, Parameters::ZXTune::Core::Plugins::Multi::PARALLEL_RENDERING);
+      return MakePtr<MultiRenderer>(std::move(delegates), parallel);
+    }
+
+  private:
+    // Each frame delegates are rendered concurrently, the first one on the calling thread. Mixing is performed in the
+    // same order as in sequential mode to get identical result.
+    void RenderParallel()
+    {
+      for (std::size_t idx = 1, lim = Delegates.size(); idx != lim; ++idx)
+      {
+        if (Target.NeedStream(idx))
+        {
+          Tasks.Fork([this, idx]() { Rendered[idx] = Delegates[idx]->Render(); });
+        }
+      }
+      if (Target.NeedStream(0))
+      {
+        Tasks.Execute([this]() { Rendered[0] = Delegates[0]->Render(); });
+      }
+      Tasks.Join();
+      for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
+      {
+        if (Target.NeedStream(idx))
+        {
+          Target.MixStream(idx, Rendered[idx]);
+          Rendered[idx] = {};
+        }
+      }
     }
 
   private:
     const RenderersArray Delegates;
     CumulativeChunk Target;
+    const bool Parallel;
+    std::vector<Sound::Chunk> Rendered;
+    ForkJoin Tasks;
   };
 
   class MultiHolder : public Holder
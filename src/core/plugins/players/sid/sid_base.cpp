@@ -23,6 +23,7 @@
 #include "core/plugin_attrs.h"
 #include "core/plugins_parameters.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "module/attributes.h"
 #include "parameters/tracking_helper.h"
 #include "strings/format.h"
@@ -46,6 +47,11 @@ namespace Module::Sid
 
   const uint_t VOICES = 3;
 
+  // normal emulation period at the end of seek to restore filters state
+  const auto FILTERS_RESYNC_PERIOD = Time::Milliseconds(50);
+
+  static auto& SeekTime = Metrics::GetHistogram("players.sid.seek_ns");
+
   void CheckSidplayError(bool ok)
   {
     Require(ok);  // TODO
@@ -221,6 +227,14 @@ namespace Module::Sid
 
     void Skip(uint_t samples)
     {
+      const auto resync = uint_t(FILTERS_RESYNC_PERIOD.Get() * Config.frequency / FILTERS_RESYNC_PERIOD.PER_SECOND);
+      if (samples > 2 * resync)
+      {
+        Player.fastSkip(true);
+        Player.play(nullptr, (samples - resync) * Sound::Sample::CHANNELS);
+        Player.fastSkip(false);
+        samples = resync;
+      }
       Player.play(nullptr, samples * Sound::Sample::CHANNELS);
     }
 
@@ -270,6 +284,7 @@ namespace Module::Sid
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine->Load(*Tune);
@@ -42,6 +42,7 @@
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 extern "C"
 {
@@ -229,9 +230,141 @@ namespace Module::VGMStream
   };
 
   const Time::Milliseconds FRAME_DURATION(20);
+  const uint_t SEEK_INTERVAL_SECONDS = 5;
 
   using VGMStreamPtr = std::shared_ptr<VGMSTREAM>;
 
+  // Decoder state snapshot for codecs keeping the whole state in VGMSTREAM and its channels (PCM/ADPCM families)
+  class SeekPoint
+  {
+  public:
+    explicit SeekPoint(const VGMSTREAM& stream)
+      : State(stream)
+      , Channels(stream.ch, stream.ch + stream.channels)
+    {
+      if (stream.hit_loop && stream.loop_ch)
+      {
+        LoopChannels.assign(stream.loop_ch, stream.loop_ch + stream.channels);
+      }
+    }
+
+    int32_t Sample() const
+    {
+      return State.current_sample;
+    }
+
+    void Restore(VGMSTREAM& stream) const
+    {
+      stream.codec_endian = State.codec_endian;
+      stream.codec_config = State.codec_config;
+      stream.codec_internal_updates = State.codec_internal_updates;
+      stream.ws_output_size = State.ws_output_size;
+      stream.current_sample = State.current_sample;
+      stream.samples_into_block = State.samples_into_block;
+      stream.current_block_offset = State.current_block_offset;
+      stream.current_block_size = State.current_block_size;
+      stream.current_block_samples = State.current_block_samples;
+      stream.next_block_offset = State.next_block_offset;
+      stream.full_block_size = State.full_block_size;
+      stream.loop_current_sample = State.loop_current_sample;
+      stream.loop_samples_into_block = State.loop_samples_into_block;
+      stream.loop_block_offset = State.loop_block_offset;
+      stream.loop_block_size = State.loop_block_size;
+      stream.loop_block_samples = State.loop_block_samples;
+      stream.loop_next_block_offset = State.loop_next_block_offset;
+      stream.loop_full_block_size = State.loop_full_block_size;
+      stream.hit_loop = State.hit_loop;
+      RestoreChannels(Channels, stream.ch);
+      if (!LoopChannels.empty())
+      {
+        RestoreChannels(LoopChannels, stream.loop_ch);
+      }
+    }
+
+  private:
+    static void RestoreChannels(const std::vector<VGMSTREAMCHANNEL>& src, VGMSTREAMCHANNEL* dst)
+    {
+      for (const auto& in : src)
+      {
+        // files are owned by target stream
+        auto* const file = dst->streamfile;
+        *dst = in;
+        dst->streamfile = file;
+        ++dst;
+      }
+    }
+
+  private:
+    const VGMSTREAM State;
+    const std::vector<VGMSTREAMCHANNEL> Channels;
+    std::vector<VGMSTREAMCHANNEL> LoopChannels;
+  };
+
+  // Checkpoints of the renderer's first playback pass. Stream is owned by single renderer, as well as its states
+  class SeekTable
+  {
+  public:
+    using Ptr = std::shared_ptr<SeekTable>;
+
+    explicit SeekTable(uint_t interval)
+      : Interval(interval)
+    {}
+
+    static bool IsApplicable(const VGMSTREAM& stream)
+    {
+      return !stream.codec_data && !stream.layout_data;
+    }
+
+    //! @return position of the next point to be added
+    uint_t GetNextPosition() const
+    {
+      return GetLastPosition() + Interval;
+    }
+
+    void Add(const VGMSTREAM& stream)
+    {
+      // further passes may differ in decoder's state due to loops handling
+      if (stream.loop_count != 0)
+      {
+        return;
+      }
+      if (uint_t(stream.current_sample) >= GetLastPosition() + Interval)
+      {
+        Points.emplace_back(stream);
+      }
+    }
+
+    //! @brief Restores stream state to the nearest point at or before target if it's better than decoding
+    //! @return true if state was changed
+    bool Restore(uint_t target, VGMSTREAM& stream) const
+    {
+      const auto it = std::upper_bound(Points.begin(), Points.end(), target,
+                                       [](uint_t pos, const SeekPoint& point) { return pos < uint_t(point.Sample()); });
+      if (it == Points.begin())
+      {
+        return false;
+      }
+      const auto& point = *std::prev(it);
+      const auto current = uint_t(stream.current_sample);
+      if (target < current || current < uint_t(point.Sample()))
+      {
+        point.Restore(stream);
+        return true;
+      }
+      return false;
+    }
+
+  private:
+    uint_t GetLastPosition() const
+    {
+      return Points.empty() ? 0 : Points.back().Sample();
+    }
+
+  private:
+    const uint_t Interval;
+    std::vector<SeekPoint> Points;
+  };
+
   class State : public Module::State
   {
   public:
@@ -263,6 +396,8 @@ namespace Module::VGMStream
   public:
     Renderer(VGMStreamPtr tune, uint_t samplerate)
       : Tune(std::move(tune))
+      , Seeks(SeekTable::IsApplicable(*Tune) ? MakePtr<SeekTable>(Tune->sample_rate * SEEK_INTERVAL_SECONDS)
+                                             : SeekTable::Ptr())
       , Status(MakePtr<State>(Tune))
       , SamplesPerFrame(FRAME_DURATION.Get() * Tune->sample_rate / FRAME_DURATION.PER_SECOND)
       , Target(Sound::CreateResampler(Tune->sample_rate, samplerate))
@@ -289,6 +424,10 @@ namespace Module::VGMStream
       Sound::Chunk result(Math::Align<uint_t>(multichannelSamples, Sound::Sample::CHANNELS) / Sound::Sample::CHANNELS);
       const auto current_before = Tune->current_sample;
       const auto done = ::render_vgmstream(safe_ptr_cast<sample_t*>(result.data()), toRender, Tune.get());
+      if (Seeks)
+      {
+        Seeks->Add(*Tune);
+      }
       if (Tune->current_sample == Tune->num_samples || Tune->current_sample == current_before)
       {
         // TODO: take into account loop_end_sample
@@ -327,12 +466,42 @@ namespace Module::VGMStream
     {
       // Keep total playback history
       const auto play_duration = Tune->pstate.play_duration;
+      if (Seeks)
+      {
+        SeekUsingTable(samples);
+      }
       ::seek_vgmstream(Tune.get(), samples);
       Tune->pstate.play_duration = play_duration;
     }
 
+    // Moves close to target, remaining samples are decoded by vgmstream itself
+    void SeekUsingTable(uint_t samples)
+    {
+      const auto rewind = samples < uint_t(Tune->current_sample);
+      // forward jump to the first pass state is allowed only from the first pass
+      if ((rewind || Tune->loop_count == 0) && Seeks->Restore(samples, *Tune) && rewind)
+      {
+        // as after reset_vgmstream
+        Tune->loop_count = 0;
+      }
+      // fill the gaps of the table decoding step by step
+      for (auto next = Seeks->GetNextPosition();
+           Tune->loop_count == 0 && uint_t(Tune->current_sample) < next && next < samples;
+           next = Seeks->GetNextPosition())
+      {
+        ::seek_vgmstream(Tune.get(), next);
+        if (uint_t(Tune->current_sample) != next)
+        {
+          // looped or stopped
+          break;
+        }
+        Seeks->Add(*Tune);
+      }
+    }
+
   private:
     const VGMStreamPtr Tune;
+    const SeekTable::Ptr Seeks;
     const State::Ptr Status;
     const uint_t SamplesPerFrame;
     const Sound::Converter::Ptr Target;
@@ -26,6 +26,17 @@ namespace Parameters::ZXTune::Core::Plugins
   const auto DEFAULT_DURATION = PREFIX + "default_duration"_id;
   //@}
 
+  //@{
+  //! @name Archived files prefetching during detection
+
+  //! @brief Threads count used to extract upcoming files of archives in background. 0 to disable
+  const auto PREFETCH_THREADS = PREFIX + "prefetch_threads"_id;
+  //! Default value for size limit (64Mb)
+  const IntType PREFETCH_SIZE_DEFAULT = 64 << 20;
+  //! @brief Approximate size limit in bytes for extracted but not yet processed files
+  const auto PREFETCH_SIZE = PREFIX + "prefetch_size"_id;
+  //@}
+
   //! @brief RAW scaner parameters namespace
   namespace Raw
   {
@@ -47,6 +58,15 @@ namespace Parameters::ZXTune::Core::Plugins
     //! Parameter name
     const auto MIN_SIZE = PREFIX + "min_size"_id;
     //@}
+
+    //@{
+    //! @name Size of data window scanned by each worker. Larger data is scanned concurrently, 0 to disable
+
+    //! Default value
+    const IntType PARALLEL_WINDOW_DEFAULT = 1048576;
+    //! Parameter name
+    const auto PARALLEL_WINDOW = PREFIX + "parallel_window"_id;
+    //@}
   }  // namespace Raw
 
   //! @brief HRIP container parameters namespace
@@ -78,6 +98,17 @@ namespace Parameters::ZXTune::Core::Plugins
     //@}
   }  // namespace SID
 
+  //! @brief Multidevice chiptunes player parameters namespace
+  namespace Multi
+  {
+    //! @brief Parameters#ZXTune#Core#Plugins#Multi namespace prefix
+    const auto PREFIX = Plugins::PREFIX + "multi"_id;
+
+    //! @brief Render devices concurrently using shared workers
+    //! @details 1 if do so
+    const auto PARALLEL_RENDERING = PREFIX + "parallel_rendering"_id;
+  }  // namespace Multi
+
   //! @brief ZIP container parameters namespace
   namespace Zip
   {
@@ -18,6 +18,7 @@
 
 #include "core/additional_files_resolve.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "module/attributes.h"
 #include "strings/map.h"
 
@@ -28,6 +29,8 @@
 namespace ZXTune
 {
   const Debug::Stream Dbg("Core::Service");
+  static auto& DetectTime = Metrics::GetHistogram("core.detect_ns");
+  static auto& DetectedCount = Metrics::GetCounter("core.detect.matched");
   using Module::translate;
 
   class LocationSource
@@ -326,12 +329,14 @@ namespace ZXTune
     template<class PluginsSet, class CallbackType>
     std::size_t DetectBy(const PluginsSet& pluginsSet, DataLocation::Ptr location, CallbackType& callback) const
     {
+      const Metrics::ScopedTimer timer(DetectTime);
       for (const auto& plugin : pluginsSet)
       {
         const auto result = plugin->Detect(*Params, location, callback);
         if (auto usedSize = result->GetMatchedDataSize())
         {
           Dbg("Detected {} in {} bytes at {}.", plugin->Id(), usedSize, location->GetPath()->AsString());
+          DetectedCount.Add();
           return usedSize;
         }
       }
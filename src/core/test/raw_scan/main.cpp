@@ -0,0 +1,128 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Raw scaner test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "binary/container_factories.h"
+#include "binary/dump.h"
+#include "core/data_location.h"
+#include "core/plugin.h"
+#include "core/plugins_parameters.h"
+#include "core/service.h"
+#include "io/api.h"
+#include "parameters/container.h"
+#include "tools/progress_callback.h"
+
+#include "error.h"
+#include "string_view.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+  const std::size_t DATA_SIZE = 3 << 20;
+
+  // placed at the both sides of windows boundaries and inside windows
+  const std::pair<std::size_t, StringView> MODULES[] = {
+      {1000, "../../../../samples/chiptunes/AY-3-8910/pt3/Speccy2.pt3"},
+      {65536 - 200, "../../../../samples/chiptunes/AY-3-8910/stc/TOXIC2.stc"},
+      {3 * 65536 - 7, "../../../../samples/chiptunes/AY-3-8910/asc/SANDRA.asc"},
+      {(1 << 20) - 1, "../../../../samples/chiptunes/AY-3-8910/sqt/tsd.sqt"},
+      {(1 << 20) + 12345, "../../../../samples/chiptunes/AY-3-8910/stp/iris_setup.stp"},
+      {(2 << 20) + 4095, "../../../../samples/chiptunes/AY-3-8910/pt3/Lat_mix2.pt3"},
+      {DATA_SIZE - 20000, "../../../../samples/chiptunes/AY-3-8910/stc/stracker.stc"},
+  };
+
+  Binary::Container::Ptr CreateData()
+  {
+    Binary::Dump result(DATA_SIZE);
+    uint32_t seed = 12345;
+    std::generate(result.begin(), result.end(), [&seed]() {
+      seed = seed * 1103515245 + 12345;
+      return static_cast<uint8_t>(seed >> 16);
+    });
+    const auto params = Parameters::Container::Create();
+    for (const auto& [offset, path] : MODULES)
+    {
+      const auto data = IO::OpenData(path, *params, Log::ProgressCallback::Stub());
+      const auto* const start = static_cast<const uint8_t*>(data->Start());
+      std::copy_n(start, std::min(data->Size(), DATA_SIZE - offset), result.begin() + offset);
+    }
+    return Binary::CreateContainer(std::make_unique<Binary::Dump>(std::move(result)));
+  }
+
+  class RecordingCallback : public Module::DetectCallback
+  {
+  public:
+    Parameters::Container::Ptr CreateInitialProperties(StringView /*subpath*/) const override
+    {
+      return Parameters::Container::Create();
+    }
+
+    void ProcessModule(const ZXTune::DataLocation& location, const ZXTune::Plugin& decoder,
+                       Module::Holder::Ptr /*holder*/) override
+    {
+      Events.emplace_back(location.GetPath()->AsString() + ' ' + String(decoder.Id()));
+    }
+
+    void ProcessUnknownData(const ZXTune::DataLocation& location) override
+    {
+      Events.emplace_back(location.GetPath()->AsString() + " unknown " + std::to_string(location.GetData()->Size()));
+    }
+
+    Log::ProgressCallback* GetProgress() const override
+    {
+      return nullptr;
+    }
+
+    std::vector<String> Events;
+  };
+
+  std::vector<String> Scan(Binary::Container::Ptr data, std::size_t window)
+  {
+    const auto params = Parameters::Container::Create();
+    params->SetValue(Parameters::ZXTune::Core::Plugins::Raw::PARALLEL_WINDOW, window);
+    RecordingCallback cb;
+    ZXTune::Service::Create(params)->DetectModules(std::move(data), cb);
+    return std::move(cb.Events);
+  }
+
+  void Test(bool res, StringView text)
+  {
+    std::cout << (res ? "Passed" : "Failed") << " test '" << text << "'" << std::endl;
+    if (!res)
+    {
+      throw Error(THIS_LINE, "Test failed");
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    const auto data = CreateData();
+    const auto serial = Scan(data, 0);
+    const auto modules = std::count_if(serial.begin(), serial.end(),
+                                       [](const String& evt) { return evt.find(" unknown ") == evt.npos; });
+    Test(modules >= static_cast<std::ptrdiff_t>(std::size(MODULES)), "Serial scan");
+    for (const std::size_t window : {4096, 65536, 1 << 20})
+    {
+      const auto parallel = Scan(data, window);
+      Test(parallel == serial, "Parallel scan by " + std::to_string(window) + " bytes");
+    }
+    return 0;
+  }
+  catch (const Error& e)
+  {
+    std::cout << e.ToString() << std::endl;
+    return 1;
+  }
+}
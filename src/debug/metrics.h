@@ -0,0 +1,17 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Performance metrics interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#ifdef NO_METRICS
+#  include "src/metrics_stub.h"
+#else
+#  include "src/metrics_real.h"
+#endif
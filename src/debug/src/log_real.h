@@ -51,6 +51,11 @@ namespace Debug
       , Enabled(IsEnabledFor(Module))
     {}
 
+    bool IsEnabled() const
+    {
+      return Enabled;
+    }
+
     //! @brief Conditionally outputs debug message from specified module
     void operator()(const char* msg) const
     {
@@ -21,6 +21,11 @@ namespace Debug
   public:
     explicit Stream(const char* /*module*/) {}
 
+    bool IsEnabled() const
+    {
+      return false;
+    }
+
     template<class... P>
     void operator()(const char* /*msg*/, P&&... /*p*/) const
     {}
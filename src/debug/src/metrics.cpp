@@ -0,0 +1,273 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Performance metrics implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "metrics_real.h"
+
+#include "strings/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace Metrics
+{
+  uint64_t HistogramSnapshot::Percentile(uint_t pct) const
+  {
+    const auto limit = (Count * pct + 99) / 100;
+    uint64_t done = 0;
+    for (std::size_t idx = 0; idx != BUCKETS; ++idx)
+    {
+      done += Buckets[idx];
+      if (done != 0 && done >= limit)
+      {
+        return idx != 0 ? std::min(Max, (uint64_t(1) << idx) - 1) : 0;
+      }
+    }
+    return Max;
+  }
+
+  HistogramSnapshot Histogram::Get() const
+  {
+    HistogramSnapshot res;
+    for (std::size_t idx = 0; idx != HistogramSnapshot::BUCKETS; ++idx)
+    {
+      res.Buckets[idx] = Buckets[idx].load(std::memory_order_relaxed);
+    }
+    res.Count = Count.load(std::memory_order_relaxed);
+    res.Sum = Sum.load(std::memory_order_relaxed);
+    res.Min = res.Count ? Min.load(std::memory_order_relaxed) : 0;
+    res.Max = Max.load(std::memory_order_relaxed);
+    return res;
+  }
+
+  class Registry
+  {
+  public:
+    static Registry& Instance()
+    {
+      // intentionally never destroyed- metrics may be updated from static objects destructors
+      static auto* const instance = new Registry();
+      return *instance;
+    }
+
+    Counter& GetCounter(StringView name)
+    {
+      return Get(Counters, name);
+    }
+
+    Histogram& GetHistogram(StringView name)
+    {
+      return Get(Histograms, name);
+    }
+
+    void Collect(Visitor& visitor) const
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      for (const auto& counter : Counters)
+      {
+        visitor.OnCounter(counter.first, counter.second->Get());
+      }
+      for (const auto& hist : Histograms)
+      {
+        visitor.OnHistogram(hist.first, hist.second->Get());
+      }
+    }
+
+  private:
+    Registry() = default;
+
+    template<class T>
+    T& Get(std::map<String, std::unique_ptr<T>, std::less<>>& storage, StringView name)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      const auto it = storage.find(name);
+      if (it != storage.end())
+      {
+        return *it->second;
+      }
+      String key(name);
+      auto& res = storage[key];
+      res = std::make_unique<T>(std::move(key));
+      return *res;
+    }
+
+  private:
+    mutable std::mutex Guard;
+    std::map<String, std::unique_ptr<Counter>, std::less<>> Counters;
+    std::map<String, std::unique_ptr<Histogram>, std::less<>> Histograms;
+  };
+
+  Counter& GetCounter(StringView name)
+  {
+    return Registry::Instance().GetCounter(name);
+  }
+
+  Histogram& GetHistogram(StringView name)
+  {
+    return Registry::Instance().GetHistogram(name);
+  }
+
+  void Collect(Visitor& visitor)
+  {
+    Registry::Instance().Collect(visitor);
+  }
+
+  class ReportBuilder : public Visitor
+  {
+  public:
+    void OnCounter(const String& name, uint64_t value) override
+    {
+      if (value)
+      {
+        Counters += Strings::Format("{:<40} {:>12}\n", name, value);
+      }
+    }
+
+    void OnHistogram(const String& name, const HistogramSnapshot& value) override
+    {
+      if (value.Count)
+      {
+        Histograms += Strings::Format("{:<40} {:>12} {:>16} {:>12} {:>12} {:>12} {:>12}\n", name, value.Count,
+                                      value.Sum, value.Sum / value.Count, value.Percentile(50),
+                                      value.Percentile(99), value.Max);
+      }
+    }
+
+    String GetResult() const
+    {
+      String res;
+      if (!Counters.empty())
+      {
+        res += Strings::Format("{:<40} {:>12}\n", "Counter", "Value");
+        res += Counters;
+      }
+      if (!Histograms.empty())
+      {
+        res += Strings::Format("{:<40} {:>12} {:>16} {:>12} {:>12} {:>12} {:>12}\n", "Histogram", "Count", "Sum",
+                               "Avg", "P50", "P99", "Max");
+        res += Histograms;
+      }
+      return res;
+    }
+
+  private:
+    String Counters;
+    String Histograms;
+  };
+
+  String MakeReport()
+  {
+    ReportBuilder builder;
+    Collect(builder);
+    return builder.GetResult();
+  }
+}  // namespace Metrics
+
+namespace Metrics
+{
+  namespace Details
+  {
+    std::atomic<bool> Tracing = false;
+  }  // namespace Details
+
+  // See https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+  class TraceWriter
+  {
+  public:
+    static TraceWriter& Instance()
+    {
+      static auto* const instance = new TraceWriter();
+      return *instance;
+    }
+
+    bool Start(const String& filename)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      Finish();
+      Stream.open(filename, std::ios::out | std::ios::trunc);
+      if (!Stream)
+      {
+        return false;
+      }
+      Stream << '[';
+      Events = 0;
+      Details::Tracing = true;
+      return true;
+    }
+
+    void Stop()
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      Finish();
+    }
+
+    void Add(StringView name, uint64_t startNs, uint64_t durationNs)
+    {
+      const auto thread = GetThreadId();
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (Stream.is_open())
+      {
+        // category is the first component of name
+        const auto category = name.substr(0, name.find('.'));
+        // complete event with microseconds timestamps
+        Stream << (Events++ ? ",\n" : "\n")
+               << Strings::Format(R"({{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{}.{:03},)"
+                                  R"("dur":{}.{:03}}})",
+                                  name, category, thread, startNs / 1000, startNs % 1000, durationNs / 1000,
+                                  durationNs % 1000);
+      }
+    }
+
+  private:
+    TraceWriter() = default;
+
+    void Finish()
+    {
+      Details::Tracing = false;
+      if (Stream.is_open())
+      {
+        Stream << "\n]\n";
+        Stream.close();
+      }
+    }
+
+    static uint_t GetThreadId()
+    {
+      static std::atomic<uint_t> lastId = 0;
+      static thread_local const uint_t id = ++lastId;
+      return id;
+    }
+
+  private:
+    std::mutex Guard;
+    std::ofstream Stream;
+    std::size_t Events = 0;
+  };
+
+  namespace Details
+  {
+    void AddTraceEvent(const Histogram& hist, uint64_t startNs, uint64_t durationNs)
+    {
+      TraceWriter::Instance().Add(hist.GetName(), startNs, durationNs);
+    }
+  }  // namespace Details
+
+  bool StartTrace(const String& filename)
+  {
+    return TraceWriter::Instance().Start(filename);
+  }
+
+  void StopTrace()
+  {
+    TraceWriter::Instance().Stop();
+  }
+}  // namespace Metrics
@@ -0,0 +1,190 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Performance metrics implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "string_type.h"
+#include "string_view.h"
+#include "types.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace Metrics
+{
+  struct HistogramSnapshot
+  {
+    static const std::size_t BUCKETS = 64;
+
+    uint64_t Count = 0;
+    uint64_t Sum = 0;
+    uint64_t Min = 0;
+    uint64_t Max = 0;
+    //! Bucket N contains values in range [2^(N-1), 2^N)
+    std::array<uint64_t, BUCKETS> Buckets = {};
+
+    //! @return Upper bound of bucket containing specified percentile
+    uint64_t Percentile(uint_t pct) const;
+  };
+
+  //! @brief Monotonic process-wide counter
+  class Counter
+  {
+  public:
+    explicit Counter(String name)
+      : Name(std::move(name))
+    {}
+
+    void Add(uint64_t delta = 1)
+    {
+      Value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    const String& GetName() const
+    {
+      return Name;
+    }
+
+    uint64_t Get() const
+    {
+      return Value.load(std::memory_order_relaxed);
+    }
+
+  private:
+    const String Name;
+    std::atomic<uint64_t> Value = 0;
+  };
+
+  //! @brief Log2-bucketed values distribution
+  class Histogram
+  {
+  public:
+    explicit Histogram(String name)
+      : Name(std::move(name))
+    {}
+
+    void Add(uint64_t value)
+    {
+      Buckets[GetBucket(value)].fetch_add(1, std::memory_order_relaxed);
+      Count.fetch_add(1, std::memory_order_relaxed);
+      Sum.fetch_add(value, std::memory_order_relaxed);
+      for (auto min = Min.load(std::memory_order_relaxed);
+           value < min && !Min.compare_exchange_weak(min, value, std::memory_order_relaxed);)
+      {}
+      for (auto max = Max.load(std::memory_order_relaxed);
+           value > max && !Max.compare_exchange_weak(max, value, std::memory_order_relaxed);)
+      {}
+    }
+
+    const String& GetName() const
+    {
+      return Name;
+    }
+
+    HistogramSnapshot Get() const;
+
+  private:
+    static std::size_t GetBucket(uint64_t value)
+    {
+      std::size_t res = 0;
+      for (; value != 0 && res != HistogramSnapshot::BUCKETS - 1; value >>= 1)
+      {
+        ++res;
+      }
+      return res;
+    }
+
+  private:
+    const String Name;
+    std::array<std::atomic<uint64_t>, HistogramSnapshot::BUCKETS> Buckets = {};
+    std::atomic<uint64_t> Count = 0;
+    std::atomic<uint64_t> Sum = 0;
+    std::atomic<uint64_t> Min = ~uint64_t(0);
+    std::atomic<uint64_t> Max = 0;
+  };
+
+  //! @return Process-wide counter with specified name, created at first access
+  Counter& GetCounter(StringView name);
+  //! @return Process-wide histogram with specified name, created at first access
+  Histogram& GetHistogram(StringView name);
+
+  namespace Details
+  {
+    extern std::atomic<bool> Tracing;
+
+    void AddTraceEvent(const Histogram& hist, uint64_t startNs, uint64_t durationNs);
+  }  // namespace Details
+
+  /*
+     @brief Stores scope execution time in nanoseconds to histogram and active trace
+     @code
+       static auto& DecodeTime = Metrics::GetHistogram("core.decode_ns");
+       ...
+       {
+         const Metrics::ScopedTimer timer(DecodeTime);
+         ...
+       }
+     @endcode
+  */
+  class ScopedTimer
+  {
+  public:
+    explicit ScopedTimer(Histogram& target)
+      : Target(target)
+      , Start(Now())
+    {}
+
+    ~ScopedTimer()
+    {
+      const auto duration = Now() - Start;
+      Target.Add(duration);
+      if (Details::Tracing.load(std::memory_order_relaxed))
+      {
+        Details::AddTraceEvent(Target, Start, duration);
+      }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    static uint64_t Now()
+    {
+      const auto now = std::chrono::steady_clock::now().time_since_epoch();
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    }
+
+  private:
+    Histogram& Target;
+    const uint64_t Start;
+  };
+
+  class Visitor
+  {
+  public:
+    virtual ~Visitor() = default;
+
+    virtual void OnCounter(const String& name, uint64_t value) = 0;
+    virtual void OnHistogram(const String& name, const HistogramSnapshot& value) = 0;
+  };
+
+  //! @brief Passes current values of all the metrics in order of names
+  void Collect(Visitor& visitor);
+
+  //! @brief Makes human-readable table of all the non-empty metrics
+  String MakeReport();
+
+  //! @brief Starts writing of all the timers to file in Chrome trace event format (chrome://tracing, Perfetto)
+  //! @return false if failed to create file
+  bool StartTrace(const String& filename);
+  //! @brief Finishes and closes active trace file
+  void StopTrace();
+}  // namespace Metrics
@@ -0,0 +1,89 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Performance metrics stub
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "string_type.h"
+#include "string_view.h"
+#include "types.h"
+
+#include <array>
+
+namespace Metrics
+{
+  struct HistogramSnapshot
+  {
+    static const std::size_t BUCKETS = 64;
+
+    uint64_t Count = 0;
+    uint64_t Sum = 0;
+    uint64_t Min = 0;
+    uint64_t Max = 0;
+    std::array<uint64_t, BUCKETS> Buckets = {};
+
+    uint64_t Percentile(uint_t /*pct*/) const
+    {
+      return 0;
+    }
+  };
+
+  class Counter
+  {
+  public:
+    void Add(uint64_t /*delta*/ = 1) {}
+  };
+
+  class Histogram
+  {
+  public:
+    void Add(uint64_t /*value*/) {}
+  };
+
+  inline Counter& GetCounter(StringView /*name*/)
+  {
+    static Counter stub;
+    return stub;
+  }
+
+  inline Histogram& GetHistogram(StringView /*name*/)
+  {
+    static Histogram stub;
+    return stub;
+  }
+
+  class ScopedTimer
+  {
+  public:
+    explicit ScopedTimer(Histogram& /*target*/) {}
+  };
+
+  class Visitor
+  {
+  public:
+    virtual ~Visitor() = default;
+
+    virtual void OnCounter(const String& name, uint64_t value) = 0;
+    virtual void OnHistogram(const String& name, const HistogramSnapshot& value) = 0;
+  };
+
+  inline void Collect(Visitor& /*visitor*/) {}
+
+  inline String MakeReport()
+  {
+    return {};
+  }
+
+  inline bool StartTrace(const String& /*filename*/)
+  {
+    return false;
+  }
+
+  inline void StopTrace() {}
+}  // namespace Metrics
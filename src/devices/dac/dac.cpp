@@ -19,8 +19,10 @@
 #include "make_ptr.h"
 #include "pointers.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <vector>
 
 namespace Devices::DAC
 {
@@ -77,37 +79,45 @@ namespace Devices::DAC
         return Pos.Integer();
       }
 
-      Sound::Sample::Type GetNearest() const
+      void Reset()
       {
-        assert(IsValid());
-        return Data[Pos.Integer()];
+        Pos = 0;
       }
 
-      Sound::Sample::Type GetInterpolated(const uint_t* lookup) const
+      //! @brief Pass up to count positions calling op(data, rawPos, idx) for each of them
+      //! @return Processed positions count. Less than count if sample is ended
+      template<class Op>
+      uint_t Process(uint_t count, Op&& op)
       {
-        assert(IsValid());
-        if (const int_t fract = Pos.Fraction())
+        if (!Data)
         {
-          const Sound::Sample::Type* const cur = Data + Pos.Integer();
-          const int_t curVal = *cur;
-          const int_t nextVal = *(cur + 1);
-          const int_t delta = nextVal - curVal;
-          return static_cast<Sound::Sample::Type>(curVal + delta * lookup[fract] / Position::PRECISION);
+          return 0;
         }
-        else
+        const auto step = Step.Raw();
+        const auto limit = Limit.Raw();
+        auto pos = Pos.Raw();
+        uint_t done = 0;
+        while (done != count && pos < limit)
         {
-          return Data[Pos.Integer()];
+          // positions till the end of sample are processed without any checks
+          const auto tillEnd = step ? (limit - pos + step - 1) / step : count;
+          const auto span = std::min(count - done, tillEnd);
+          for (const auto end = done + span; done != end; ++done, pos += step)
+          {
+            op(Data, pos, done);
+          }
+          if (pos >= limit)
+          {
+            pos = Loop.Raw();
+          }
         }
+        Pos = Position(pos, Position::PRECISION);
+        return done;
       }
 
-      void Reset()
-      {
-        Pos = 0;
-      }
-
-      void Next()
+      void Skip(uint_t count)
       {
-        Pos = GetNextPos();
+        Process(count, [](const Sound::Sample::Type*, uint_t, uint_t) {});
       }
 
       void SetPosition(uint_t pos)
@@ -132,13 +142,6 @@ namespace Devices::DAC
         Pos = std::min(Pos, Limit);
       }
 
-    private:
-      Position GetNextPos() const
-      {
-        const Position res = Pos + Step;
-        return res < Limit ? res : Loop;
-      }
-
     private:
       const Sound::Sample::Type* Data = nullptr;
       Position Step;
@@ -296,29 +299,36 @@ namespace Devices::DAC
       }
     }
 
-    Sound::Sample::Type GetNearest() const
-    {
-      return (Enabled && !Muted) ? Amplify(Iterator.GetNearest()) : Sound::Sample::MID;
-    }
-
-    Sound::Sample::Type GetInterpolated(const uint_t* lookup) const
-    {
-      return (Enabled && !Muted) ? Amplify(Iterator.GetInterpolated(lookup)) : Sound::Sample::MID;
-    }
-
-    void Next()
+    //! @brief Fill whole span of channel's output. Getter(data, rawPos) gets sample value at specified position
+    template<class Getter>
+    void Render(Sound::Sample::Type* out, uint_t count, const Getter& get)
     {
+      uint_t done = 0;
       if (Enabled)
       {
-        Iterator.Next();
+        if (Muted)
+        {
+          Iterator.Skip(count);
+        }
+        else
+        {
+          const auto level = Level;
+          done = Iterator.Process(count, [out, level, &get](const Sound::Sample::Type* data, uint_t pos, uint_t idx) {
+            out[idx] = (level * get(data, pos)).Round();
+          });
+        }
         Enabled = Iterator.IsValid();
       }
+      std::fill(out + done, out + count, Sound::Sample::MID);
     }
 
-  private:
-    Sound::Sample::Type Amplify(Sound::Sample::Type val) const
+    void Skip(uint_t count)
     {
-      return (Level * val).Round();
+      if (Enabled)
+      {
+        Iterator.Skip(count);
+        Enabled = Iterator.IsValid();
+      }
     }
   };
 
@@ -330,93 +340,86 @@ namespace Devices::DAC
     virtual Sound::Chunk RenderData(uint_t samples) = 0;
   };
 
-  template<unsigned Channels>
-  class LQRenderer : public Renderer
+  struct NearestSample
   {
-  public:
-    LQRenderer(const Sound::FixedChannelsMixer<Channels>& mixer, ChannelState* state)
-      : Mixer(mixer)
-      , State(state)
-    {}
+    Sound::Sample::Type operator()(const Sound::Sample::Type* data, uint_t pos) const
+    {
+      return data[pos / FastSample::Position::PRECISION];
+    }
+  };
 
-    Sound::Chunk RenderData(uint_t samples) override
+  class InterpolatedSample
+  {
+  public:
+    InterpolatedSample()
     {
-      Sound::Chunk chunk;
-      chunk.reserve(samples);
-      typename Sound::MultichannelSample<Channels>::Type result;
-      for (uint_t counter = samples; counter != 0; --counter)
+      for (uint_t idx = 0; idx != FastSample::Position::PRECISION; ++idx)
       {
-        for (uint_t chan = 0; chan != Channels; ++chan)
-        {
-          ChannelState& state = State[chan];
-          result[chan] = state.GetNearest();
-          state.Next();
-        }
-        chunk.push_back(Mixer.ApplyData(result));
+        const double rad = 3.14159265358 * idx / FastSample::Position::PRECISION;
+        Table[idx] = static_cast<int_t>(FastSample::Position::PRECISION * (1.0 - cos(rad)) / 2.0);
       }
-      return chunk;
+    }
+
+    // branchless, lookup for zero fraction is zero
+    Sound::Sample::Type operator()(const Sound::Sample::Type* data, uint_t pos) const
+    {
+      static_assert(FastSample::Position::PRECISION == 1 << 8, "Invalid precision");
+      const Sound::Sample::Type* const cur = data + (pos >> 8);
+      const int_t curVal = cur[0];
+      const int_t delta = cur[1] - curVal;
+      // rounding down as before
+      return static_cast<Sound::Sample::Type>(curVal + ((delta * Table[pos & 0xff]) >> 8));
     }
 
   private:
-    const Sound::FixedChannelsMixer<Channels>& Mixer;
-    ChannelState* const State;
+    std::array<int_t, FastSample::Position::PRECISION> Table;
   };
 
-  template<unsigned Channels>
-  class MQRenderer : public Renderer
+  // Channel-major rendering: whole span of each channel is rendered at once and then all spans are mixed
+  template<unsigned Channels, class Getter>
+  class SpansRenderer : public Renderer
   {
   public:
-    MQRenderer(const Sound::FixedChannelsMixer<Channels>& mixer, ChannelState* state)
+    SpansRenderer(const Sound::FixedChannelsMixer<Channels>& mixer, ChannelState* state)
       : Mixer(mixer)
       , State(state)
     {}
 
     Sound::Chunk RenderData(uint_t samples) override
     {
-      static const CosineTable COSTABLE;
+      static const Getter GET;
+      for (uint_t chan = 0; chan != Channels; ++chan)
+      {
+        auto& span = Spans[chan];
+        span.resize(samples);
+        State[chan].Render(span.data(), samples, GET);
+      }
       Sound::Chunk chunk;
       chunk.reserve(samples);
       typename Sound::MultichannelSample<Channels>::Type result;
-      for (uint_t counter = samples; counter != 0; --counter)
+      for (uint_t idx = 0; idx != samples; ++idx)
       {
         for (uint_t chan = 0; chan != Channels; ++chan)
         {
-          ChannelState& state = State[chan];
-          result[chan] = state.GetInterpolated(COSTABLE.Get());
-          state.Next();
+          result[chan] = Spans[chan][idx];
         }
         chunk.push_back(Mixer.ApplyData(result));
       }
       return chunk;
     }
 
-  private:
-    class CosineTable
-    {
-    public:
-      CosineTable()
-      {
-        for (uint_t idx = 0; idx != FastSample::Position::PRECISION; ++idx)
-        {
-          const double rad = 3.14159265358 * idx / FastSample::Position::PRECISION;
-          Table[idx] = static_cast<uint_t>(FastSample::Position::PRECISION * (1.0 - cos(rad)) / 2.0);
-        }
-      }
-
-      const uint_t* Get() const
-      {
-        return Table.data();
-      }
-
-    private:
-      std::array<uint_t, FastSample::Position::PRECISION> Table;
-    };
-
   private:
     const Sound::FixedChannelsMixer<Channels>& Mixer;
     ChannelState* const State;
+    std::array<std::vector<Sound::Sample::Type>, Channels> Spans;
   };
 
+  template<unsigned Channels>
+  using LQRenderer = SpansRenderer<Channels, NearestSample>;
+
+  template<unsigned Channels>
+  using MQRenderer = SpansRenderer<Channels, InterpolatedSample>;
+
   template<unsigned Channels>
   class RenderersSet
   {
@@ -453,10 +456,7 @@ namespace Devices::DAC
     {
       for (auto state = State, lim = State + Channels; state != lim; ++state)
       {
-        for (uint_t count = 0; count != samples; ++count)
-        {
-          state->Next();
-        }
+        state->Skip(samples);
       }
     }
 
@@ -12,6 +12,8 @@
 
 #include "devices/saa/generators.h"
 
+#include <algorithm>
+
 namespace Devices::SAA
 {
   inline uint_t LoNibble(uint_t val)
@@ -108,6 +110,12 @@ namespace Devices::SAA
       return out;
     }
 
+    uint_t GetStableTicks() const
+    {
+      return std::min({Tones[0].GetStableTicks(), Tones[1].GetStableTicks(), Tones[2].GetStableTicks(),
+                       Noise.GetStableTicks(), Envelope.GetStableTicks()});
+    }
+
   private:
     void UpdateLinkedGenerators(uint_t generator)
     {
@@ -211,6 +219,12 @@ namespace Devices::SAA
       return out.Convert();
     }
 
+    //! @return ticks count GetLevels result is kept for, at least 1
+    uint_t GetStableTicks() const
+    {
+      return std::min(Subdevices[0].GetStableTicks(), Subdevices[1].GetStableTicks());
+    }
+
   private:
     SAASubDevice Subdevices[2];
   };
@@ -23,6 +23,8 @@ namespace Devices::SAA
   const uint_t LOW_LEVEL = 0;
   const uint_t HIGH_LEVEL = 15;
   const uint_t MAX_VALUE = HIGH_LEVEL + 1;
+  // for generators with constant output
+  const uint_t INFINITE_TICKS = ~uint_t(0);
 
   class FastSample
   {
@@ -121,6 +123,17 @@ namespace Devices::SAA
       return Masked;
     }
 
+    //! @return ticks count the output level is kept for, at least 1
+    uint_t GetStableTicks() const
+    {
+      if (Masked)
+      {
+        return INFINITE_TICKS;
+      }
+      WrapCounter();
+      return (Counter < HalfPeriod ? HalfPeriod : FullPeriod) - Counter;
+    }
+
   private:
     void UpdatePeriod()
     {
@@ -289,6 +302,16 @@ namespace Devices::SAA
       return Period;
     }
 
+    uint_t GetStableTicks() const
+    {
+      if (Mixer)
+      {
+        Update();
+        return Period - Counter;
+      }
+      return INFINITE_TICKS;
+    }
+
   private:
     void Update() const
     {
@@ -382,6 +405,19 @@ namespace Devices::SAA
       }
     }
 
+    uint_t GetStableTicks() const
+    {
+      if (Enabled)
+      {
+        Update();
+        if (Decay)
+        {
+          return Period - Counter;
+        }
+      }
+      return INFINITE_TICKS;
+    }
+
     uint_t GetRepetitionPeriod() const
     {
       if (Enabled)
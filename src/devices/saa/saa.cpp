@@ -19,6 +19,7 @@
 #include "contract.h"
 #include "make_ptr.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <functional>
@@ -107,6 +108,11 @@ namespace Devices::SAA
       return Device.GetLevels();
     }
 
+    uint_t GetStableTicks() const
+    {
+      return Device.GetStableTicks();
+    }
+
   private:
     SAADevice Device;
   };
@@ -136,9 +142,12 @@ namespace Devices::SAA
     {
       while (ticksPassed >= FREQ_DIVIDER)
       {
-        Filter.Feed(Delegate.GetLevels());
-        Delegate.Tick(FREQ_DIVIDER);
-        ticksPassed -= FREQ_DIVIDER;
+        // output is constant till the nearest generator's edge, so levels are calculated once per such a run
+        const uint_t stableFeeds = 1 + (Delegate.GetStableTicks() - 1) / FREQ_DIVIDER;
+        const uint_t feeds = std::min(ticksPassed / FREQ_DIVIDER, stableFeeds);
+        Filter.Feed(Delegate.GetLevels(), feeds);
+        Delegate.Tick(feeds * FREQ_DIVIDER);
+        ticksPassed -= feeds * FREQ_DIVIDER;
       }
       if (ticksPassed)
       {
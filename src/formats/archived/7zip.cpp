@@ -26,6 +26,7 @@
 
 #include <cstring>
 #include <list>
+#include <mutex>
 #include <numeric>
 
 namespace Formats::Archived
@@ -221,7 +222,8 @@ namespace Formats::Archived
 
       Binary::Container::Ptr GetFileData(uint_t idx) const
       {
-        // WARN: not thread-safe
+        // solid blocks cache is shared between files
+        const std::lock_guard<std::mutex> lock(Guard);
         size_t offset = 0;
         size_t outSizeProcessed = 0;
         CheckError(SzArEx_Extract(&Db, const_cast<ILookInStreamPtr>(&Stream.vt), idx, &Cache.BlockIndex,
@@ -250,6 +252,7 @@ namespace Formats::Archived
       LookupStream Stream;
       CSzArEx Db;
       mutable UnpackCache Cache;
+      mutable std::mutex Guard;
     };
 
     class File : public Archived::File
@@ -0,0 +1,227 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Archived files prefetching implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "formats/archived/prefetch.h"
+
+#include "debug/log.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Formats::Archived
+{
+  const Debug::Stream Dbg("Formats::Archived::Prefetch");
+
+  class FilesCollector : public Container::Walker
+  {
+  public:
+    explicit FilesCollector(const Container& container)
+      : Source(container)
+    {
+      Files.reserve(container.CountFiles());
+    }
+
+    void OnFile(const File& file) const override
+    {
+      if (!IsPersistent)
+      {
+        return;
+      }
+      auto persistent = Source.FindFile(file.GetName());
+      if (persistent.get() == &file)
+      {
+        Files.emplace_back(std::move(persistent));
+      }
+      else
+      {
+        Dbg("Temporary file object for '{}'", file.GetName());
+        IsPersistent = false;
+      }
+    }
+
+    //! @return empty result if archive is not suitable for prefetching
+    std::vector<File::Ptr> CaptureResult()
+    {
+      return IsPersistent ? std::move(Files) : std::vector<File::Ptr>();
+    }
+
+  private:
+    const Container& Source;
+    mutable bool IsPersistent = true;
+    mutable std::vector<File::Ptr> Files;
+  };
+
+  struct ExtractedData
+  {
+    Binary::Container::Ptr Data;
+    std::exception_ptr Error;
+  };
+
+  class Prefetcher
+  {
+  public:
+    Prefetcher(const std::vector<File::Ptr>& files, uint_t threads, std::size_t maxSize)
+      : Files(files)
+      , Entries(files.size())
+      , MaxSize(maxSize)
+      , MaxAhead(2 * threads)
+    {
+      Workers.reserve(threads);
+      for (uint_t idx = 0; idx != threads; ++idx)
+      {
+        Workers.emplace_back(&Prefetcher::WorkProc, this);
+      }
+    }
+
+    ~Prefetcher()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Stopped = true;
+      }
+      Changed.notify_all();
+      for (auto& worker : Workers)
+      {
+        worker.join();
+      }
+    }
+
+    ExtractedData Take(std::size_t idx)
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      auto& entry = Entries[idx];
+      Changed.wait(lock, [&entry]() { return entry.Done; });
+      Consumed = idx + 1;
+      PrefetchedSize -= entry.Size;
+      auto result = std::move(entry.Result);
+      lock.unlock();
+      Changed.notify_all();
+      return result;
+    }
+
+  private:
+    struct Entry
+    {
+      ExtractedData Result;
+      std::size_t Size = 0;
+      bool Done = false;
+    };
+
+    void WorkProc()
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      for (;;)
+      {
+        Changed.wait(lock, [this]() { return Stopped || Next == Files.size() || CanStartNext(); });
+        if (Stopped || Next == Files.size())
+        {
+          return;
+        }
+        const auto idx = Next++;
+        lock.unlock();
+        ExtractedData result;
+        try
+        {
+          result.Data = Files[idx]->GetData();
+        }
+        catch (...)
+        {
+          result.Error = std::current_exception();
+        }
+        lock.lock();
+        auto& entry = Entries[idx];
+        entry.Size = result.Data ? result.Data->Size() : 0;
+        entry.Result = std::move(result);
+        entry.Done = true;
+        PrefetchedSize += entry.Size;
+        Changed.notify_all();
+      }
+    }
+
+    bool CanStartNext() const
+    {
+      // next required file is always allowed to avoid stalling
+      return Next == Consumed || (Next < Consumed + MaxAhead && PrefetchedSize < MaxSize);
+    }
+
+  private:
+    const std::vector<File::Ptr>& Files;
+    std::vector<Entry> Entries;
+    const std::size_t MaxSize;
+    const std::size_t MaxAhead;
+    std::mutex Guard;
+    std::condition_variable Changed;
+    std::size_t Next = 0;
+    std::size_t Consumed = 0;
+    std::size_t PrefetchedSize = 0;
+    bool Stopped = false;
+    std::vector<std::thread> Workers;
+  };
+
+  class PrefetchedFile : public File
+  {
+  public:
+    PrefetchedFile(const File& delegate, ExtractedData data)
+      : Delegate(delegate)
+      , Extracted(std::move(data))
+    {}
+
+    String GetName() const override
+    {
+      return Delegate.GetName();
+    }
+
+    std::size_t GetSize() const override
+    {
+      return Delegate.GetSize();
+    }
+
+    Binary::Container::Ptr GetData() const override
+    {
+      if (Extracted.Error)
+      {
+        std::rethrow_exception(Extracted.Error);
+      }
+      return Extracted.Data;
+    }
+
+  private:
+    const File& Delegate;
+    const ExtractedData Extracted;
+  };
+
+  void ExploreFilesPrefetched(const Container& container, const Container::Walker& walker, uint_t threads,
+                              std::size_t maxPrefetchSize)
+  {
+    if (threads != 0 && container.CountFiles() > 1)
+    {
+      FilesCollector collector(container);
+      container.ExploreFiles(collector);
+      const auto files = collector.CaptureResult();
+      if (!files.empty())
+      {
+        const auto workers = static_cast<uint_t>(std::min<std::size_t>(threads, files.size()));
+        Dbg("Prefetching {} files using {} threads", files.size(), workers);
+        Prefetcher prefetcher(files, workers, maxPrefetchSize);
+        for (std::size_t idx = 0, lim = files.size(); idx != lim; ++idx)
+        {
+          const PrefetchedFile file(*files[idx], prefetcher.Take(idx));
+          walker.OnFile(file);
+        }
+        return;
+      }
+    }
+    container.ExploreFiles(walker);
+  }
+}  // namespace Formats::Archived
@@ -0,0 +1,26 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Archived files prefetching support
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "formats/archived.h"
+
+namespace Formats::Archived
+{
+  //! @brief Walks all the files stored in archive extracting upcoming ones on background threads
+  //! @param container Archive to explore
+  //! @param walker Files visitor. Called on the caller's thread in the same order as Container::ExploreFiles does
+  //! @param threads Extracting threads count. 0 means plain Container::ExploreFiles call
+  //! @param maxPrefetchSize Approximate limit for total size of extracted but not yet visited files
+  //! @note Prefetching is applied only for archives providing persistent files objects via Container::FindFile,
+  //! File::GetData should be thread-safe for them. Other archives are walked as is.
+  void ExploreFilesPrefetched(const Container& container, const Container::Walker& walker, uint_t threads,
+                              std::size_t maxPrefetchSize);
+}  // namespace Formats::Archived
@@ -0,0 +1,190 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Generic bitstream reader for packed data
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#include "formats/packed/pack_utils.h"
+
+#include "contract.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+// Order of bits consumption from unit
+enum class BitsOrder
+{
+  MSB,
+  LSB
+};
+
+// Time of unit refill
+enum class BitsRefill
+{
+  // unit is taken right before first bit is requested (ld a,(hl):inc hl on mask exhaustion)
+  LAZY,
+  // unit is taken at the beginning and right after last bit is consumed
+  EAGER
+};
+
+// Bitstream reader on top of byte source.
+// Source should provide GetByte() method and is available for direct bytes reading in between of bits.
+// Units are assembled in little-endian order. Multiple bits are extracted from unit at once, so GetBits(n)
+// does not loop over bits. Units are not prefetched beyond current, so interleaving of bits and bytes
+// reading is fully compatible with original Z80 depackers.
+template<class Source, uint_t UnitBits = 8, BitsOrder Order = BitsOrder::MSB,
+         BitsRefill Refill = BitsRefill::LAZY>
+class BitReader : public Source
+{
+  static_assert(UnitBits == 8 || UnitBits == 16, "Unsupported unit size");
+
+public:
+  template<class... Args>
+  explicit BitReader(Args&&... args)
+    : Source(std::forward<Args>(args)...)
+  {
+    if constexpr (Refill == BitsRefill::EAGER)
+    {
+      FetchUnit();
+    }
+  }
+
+  uint_t GetBit()
+  {
+    if constexpr (Refill == BitsRefill::LAZY)
+    {
+      if (!Avail)
+      {
+        FetchUnit();
+      }
+    }
+    uint_t result = 0;
+    --Avail;
+    if constexpr (Order == BitsOrder::MSB)
+    {
+      result = (Bits >> Avail) & 1;
+    }
+    else
+    {
+      result = Bits & 1;
+      Bits >>= 1;
+    }
+    if constexpr (Refill == BitsRefill::EAGER)
+    {
+      if (!Avail)
+      {
+        FetchUnit();
+      }
+    }
+    return result;
+  }
+
+  // up to 32 bits, first taken bit is the most significant one for MSB order and the least significant one for LSB
+  uint_t GetBits(uint_t count)
+  {
+    assert(count <= 32);
+    if constexpr (Refill == BitsRefill::LAZY)
+    {
+      if (!Avail && count)
+      {
+        FetchUnit();
+      }
+    }
+    if (count <= Avail)
+    {
+      return TakeBits(count);
+    }
+    return GetSplittedBits(count);
+  }
+
+private:
+  uint_t GetSplittedBits(uint_t count)
+  {
+    uint_t result = 0;
+    for (uint_t done = 0; done != count;)
+    {
+      if (!Avail)
+      {
+        FetchUnit();
+      }
+      const auto chunk = std::min(count - done, Avail);
+      const auto part = TakeBits(chunk);
+      if constexpr (Order == BitsOrder::MSB)
+      {
+        result = (result << chunk) | part;
+      }
+      else
+      {
+        result |= part << done;
+      }
+      done += chunk;
+    }
+    return result;
+  }
+
+  uint_t TakeBits(uint_t count)
+  {
+    assert(count <= Avail);
+    const uint_t mask = (uint_t(1) << count) - 1;
+    uint_t result = 0;
+    Avail -= count;
+    if constexpr (Order == BitsOrder::MSB)
+    {
+      result = (Bits >> Avail) & mask;
+    }
+    else
+    {
+      result = Bits & mask;
+      Bits >>= count;
+    }
+    if constexpr (Refill == BitsRefill::EAGER)
+    {
+      if (!Avail)
+      {
+        FetchUnit();
+      }
+    }
+    return result;
+  }
+
+  void FetchUnit()
+  {
+    if constexpr (UnitBits == 8)
+    {
+      Bits = Source::GetByte();
+    }
+    else
+    {
+      const uint_t lo = Source::GetByte();
+      const uint_t hi = Source::GetByte();
+      Bits = lo | (hi << 8);
+    }
+    Avail = UnitBits;
+  }
+
+private:
+  uint_t Bits = 0;
+  uint_t Avail = 0;
+};
+
+// Byte source throwing on overrun instead of padding by zeroes
+template<class Source>
+class SafeStream : public Source
+{
+public:
+  using Source::Source;
+
+  uint8_t GetByte()
+  {
+    Require(!Source::Eof());
+    return Source::GetByte();
+  }
+};
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/pack_utils.h"
 
@@ -197,10 +198,15 @@ namespace Formats::Packed
         return UsedData;
       }
 
-      uint8_t operator*()
+      uint8_t GetByte()
       {
         Require(!Eof());
         ++UsedData;
+        return ByteStream::GetByte();
+      }
+
+      uint8_t operator*()
+      {
         return GetByte();
       }
 
@@ -415,38 +421,13 @@ namespace Formats::Packed
       const std::unique_ptr<RawDataDecoder> Delegate;
     };
 
-    class Bitstream
+    class Bitstream : public BitReader<StreamAdapter>
     {
     public:
       Bitstream(const uint8_t* data, std::size_t size)
-        : Source(data, size)
+        : BitReader(data, size)
       {}
 
-      std::size_t GetUsedData() const
-      {
-        return Source.GetUsedData();
-      }
-
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = *Source;
-          Mask = 0x80;
-        }
-        return Bits & Mask ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
       uint_t GetIndex()
       {
         if (const uint_t len = GetBits(3))
@@ -458,11 +439,6 @@ namespace Formats::Packed
           return GetBit();
         }
       }
-
-    private:
-      StreamAdapter Source;
-      uint_t Bits = 0;
-      uint_t Mask = 0;
     };
 
     template<>
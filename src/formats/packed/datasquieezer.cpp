@@ -10,6 +10,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/pack_utils.h"
 
@@ -195,41 +196,14 @@ namespace Formats::Packed
 
     const std::size_t MIN_SIZE = sizeof(RawHeader);
 
-    // dsq bitstream decoder
-    class Bitstream
+    class ReverseByteStream
     {
     public:
-      Bitstream(const uint8_t* data, std::size_t size)
+      ReverseByteStream(const uint8_t* data, std::size_t size)
         : Data(data)
         , Pos(Data + size)
       {}
 
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = GetByte();
-          Mask = 0x80;
-        }
-        return Bits & Mask ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
-      uint8_t Get8Bits()
-      {
-        return static_cast<uint8_t>(GetBits(8));
-      }
-
-    private:
       uint8_t GetByte()
       {
         Require(Pos > Data);
@@ -239,8 +213,20 @@ namespace Formats::Packed
     private:
       const uint8_t* const Data;
       const uint8_t* Pos;
-      uint_t Bits = 0;
-      uint_t Mask = 0;
+    };
+
+    // dsq bitstream decoder
+    class Bitstream : public BitReader<ReverseByteStream>
+    {
+    public:
+      Bitstream(const uint8_t* data, std::size_t size)
+        : BitReader(data, size)
+      {}
+
+      uint8_t Get8Bits()
+      {
+        return static_cast<uint8_t>(GetBits(8));
+      }
     };
 
     class Container
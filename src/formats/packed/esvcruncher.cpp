@@ -10,6 +10,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/pack_utils.h"
 
@@ -187,11 +188,10 @@ namespace Formats::Packed
 
     const std::size_t MIN_SIZE = sizeof(RawHeader);
 
-    // dsq bitstream decoder
-    class Bitstream
+    class ReverseByteStream
     {
     public:
-      Bitstream(const uint8_t* data, std::size_t size)
+      ReverseByteStream(const uint8_t* data, std::size_t size)
         : Data(data)
         , Pos(Data + size)
       {}
@@ -206,33 +206,14 @@ namespace Formats::Packed
         return Eof() ? 0 : *--Pos;
       }
 
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = GetByte();
-          Mask = 0x80;
-        }
-        return Bits & Mask ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
     private:
       const uint8_t* const Data;
       const uint8_t* Pos;
-      uint_t Bits = 0;
-      uint_t Mask = 0;
     };
 
+    // dsq bitstream decoder
+    using Bitstream = BitReader<ReverseByteStream>;
+
     class Container
     {
     public:
@@ -10,39 +10,17 @@
 
 #pragma once
 
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/bitstream.h"
 
 // Hrust1-compatible bitstream:
 // -16 bit mask MSB->LSB order
 // -mask is taken at the beginning
-class Hrust1Bitstream : public ByteStream
+class Hrust1Bitstream : public BitReader<ByteStream, 16, BitsOrder::MSB, BitsRefill::EAGER>
 {
 public:
   Hrust1Bitstream(const uint8_t* data, std::size_t size)
-    : ByteStream(data, size)
-  {
-    InitMask();
-  }
-
-  uint_t GetBit()
-  {
-    const uint_t result = (Bits & Mask) != 0 ? 1 : 0;
-    if (!(Mask >>= 1))
-    {
-      InitMask();
-    }
-    return result;
-  }
-
-  uint_t GetBits(uint_t count)
-  {
-    uint_t result = 0;
-    while (count--)
-    {
-      result = 2 * result | GetBit();
-    }
-    return result;
-  }
+    : BitReader(data, size)
+  {}
 
   uint_t GetLen()
   {
@@ -54,15 +32,4 @@ public:
     }
     return len;
   }
-
-private:
-  void InitMask()
-  {
-    Bits = GetLEWord();
-    Mask = 0x8000;
-  }
-
-private:
-  uint_t Bits = 0;
-  uint_t Mask = 0;
 };
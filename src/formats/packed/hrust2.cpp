@@ -10,6 +10,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/hrust1_bitstream.h"
 #include "formats/packed/pack_utils.h"
@@ -130,33 +131,13 @@ namespace Formats::Packed
     static_assert(sizeof(Version3::FormatHeader) * alignof(Version3::FormatHeader) == 31, "Invalid layout");
 
     // hrust2x bitstream decoder
-    class Bitstream : public ByteStream
+    class Bitstream : public BitReader<ByteStream>
     {
     public:
       Bitstream(const uint8_t* data, std::size_t size)
-        : ByteStream(data, size)
+        : BitReader(data, size)
       {}
 
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = GetByte();
-          Mask = 0x80;
-        }
-        return Bits & Mask ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
       uint_t GetLen()
       {
         uint_t len = 1;
@@ -191,10 +172,6 @@ namespace Formats::Packed
           return static_cast<int16_t>((res << 8) + GetByte());
         }
       }
-
-    private:
-      uint_t Bits = 0;
-      uint_t Mask = 0;
     };
 
     class RawDataDecoder
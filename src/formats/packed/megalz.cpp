@@ -8,6 +8,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/pack_utils.h"
 
@@ -56,39 +57,13 @@ namespace Formats::Packed
         "013f03"  // ld bc,#033f
         ""sv;
 
-    class Bitstream : private ByteStream
+    class Bitstream : public BitReader<SafeStream<ByteStream>>
     {
     public:
       explicit Bitstream(Binary::View data)
-        : ByteStream(data.As<uint8_t>(), data.Size())
+        : BitReader(data.As<uint8_t>(), data.Size())
       {}
 
-      uint8_t GetByte()
-      {
-        Require(!Eof());
-        return ByteStream::GetByte();
-      }
-
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = GetByte();
-          Mask = 0x80;
-        }
-        return Bits & Mask ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
       uint_t GetLen()
       {
         uint_t len = 1;
@@ -111,12 +86,6 @@ namespace Formats::Packed
           return static_cast<int16_t>(0xff00 + GetByte());
         }
       }
-
-      using ByteStream::GetProcessedBytes;
-
-    private:
-      uint_t Bits = 0;
-      uint_t Mask = 0;
     };
 
     class DataDecoder
@@ -61,20 +61,26 @@ private:
   const std::size_t Size;
 };
 
-template<class Iterator, class ConstIterator>
-void RecursiveCopy(ConstIterator srcBegin, ConstIterator srcEnd, Iterator dstBegin)
+// Copy data from already decoded area with possible overlapping (src < dst)
+inline void CopyForward(const uint8_t* src, uint8_t* dst, std::size_t count)
 {
-  const ConstIterator constDst = dstBegin;
-  if (std::distance(srcEnd, constDst) >= 0)
+  const std::size_t distance = dst - src;
+  if (distance >= count)
   {
-    std::copy(srcBegin, srcEnd, dstBegin);
+    std::memcpy(dst, src, count);
   }
-  else
+  else if (distance == 1)
+  {
+    std::memset(dst, *src, count);
+  }
+  else if (distance != 0)
   {
-    Iterator dst = dstBegin;
-    for (ConstIterator src = srcBegin; src != srcEnd; ++src, ++dst)
+    // source area is periodic, so each step doubles size of available continuous block
+    for (std::size_t done = 0; done < count;)
     {
-      *dst = *src;
+      const auto chunk = std::min(count - done, distance + done);
+      std::memcpy(dst + done, src, chunk);
+      done += chunk;
     }
   }
 }
@@ -107,8 +113,7 @@ inline bool CopyFromBack(std::size_t offset, Binary::DataBuilder& dst, std::size
     return false;  // invalid backref
   }
   auto* dstStart = static_cast<uint8_t*>(dst.Allocate(count));
-  const auto* srcStart = dstStart - offset;
-  RecursiveCopy(srcStart, srcStart + count, dstStart);
+  CopyForward(dstStart - offset, dstStart, count);
   return true;
 }
 
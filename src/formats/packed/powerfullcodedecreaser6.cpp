@@ -10,6 +10,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/hrust1_bitstream.h"
 #include "formats/packed/pack_utils.h"
@@ -264,37 +265,7 @@ namespace Formats::Packed
       const std::size_t Size;
     };
 
-    class Bitstream : public ByteStream
-    {
-    public:
-      Bitstream(const uint8_t* data, std::size_t size)
-        : ByteStream(data, size)
-      {}
-
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = GetLEWord();
-          Mask = 0x8000;
-        }
-        return (Bits & Mask) != 0 ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
-    private:
-      uint_t Bits = 0;
-      uint_t Mask = 0;
-    };
+    using Bitstream = BitReader<ByteStream, 16>;
 
     class BitstreamDecoder
     {
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "formats/packed/bitstream.h"
 #include "formats/packed/container.h"
 #include "formats/packed/pack_utils.h"
 
@@ -204,47 +205,13 @@ namespace Formats::Packed
     };
 
     // implode bitstream decoder
-    class SafeByteStream : public ByteStream
-    {
-    public:
-      SafeByteStream(const uint8_t* data, std::size_t size)
-        : ByteStream(data, size)
-      {}
-
-      uint8_t GetByte()
-      {
-        Require(!Eof());
-        return ByteStream::GetByte();
-      }
-    };
-
-    class Bitstream : public SafeByteStream
+    class Bitstream : public BitReader<SafeStream<ByteStream>, 8, BitsOrder::LSB>
     {
     public:
       Bitstream(const uint8_t* data, std::size_t size)
-        : SafeByteStream(data, size)
+        : BitReader(data, size)
       {}
 
-      bool GetBit()
-      {
-        if ((Mask <<= 1) > 255)
-        {
-          Bits = GetByte();
-          Mask = 0x1;
-        }
-        return 0 != (Bits & Mask);
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        for (uint_t idx = 0; idx < count; ++idx)
-        {
-          result = result | (GetBit() << idx);
-        }
-        return result;
-      }
-
       uint_t ReadByTree(const std::vector<SFTEntry>& tree)
       {
         auto it = tree.begin();
@@ -262,10 +229,6 @@ namespace Formats::Packed
         }
         return 0;
       }
-
-    private:
-      uint_t Bits = 0;
-      uint_t Mask = 128;
     };
 
     class ImplodeDataDecoder : public DataDecoder
@@ -0,0 +1,74 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Depackers throughput benchmark
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "formats/test/utils.h"
+
+#include <chrono>
+#include <iomanip>
+
+namespace
+{
+  const auto TEST_DURATION = std::chrono::milliseconds(200);
+
+  // Returns decoded megabytes per second
+  double MeasureDecoding(const Formats::Packed::Decoder& decoder, const Binary::Container& data)
+  {
+    using Clock = std::chrono::steady_clock;
+    std::size_t totalSize = 0;
+    const auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    do
+    {
+      const auto unpacked = decoder.Decode(data);
+      if (!unpacked)
+      {
+        throw std::runtime_error("Failed to decode");
+      }
+      totalSize += unpacked->Size();
+      elapsed = Clock::now() - start;
+    } while (elapsed < TEST_DURATION);
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    return totalSize / seconds / (1024 * 1024);
+  }
+
+  void Benchmark(const Formats::Packed::Decoder& decoder, StringView dir, const std::vector<std::string>& tests)
+  {
+    std::cout << decoder.GetDescription() << std::endl;
+    for (const auto& test : tests)
+    {
+      const auto data = Test::OpenFile("../" + std::string{dir} + '/' + test);
+      std::cout << "  " << std::setw(16) << std::left << test << std::fixed << std::setprecision(2)
+                << MeasureDecoding(decoder, *data) << " Mb/s" << std::endl;
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    using namespace Formats::Packed;
+    Benchmark(*CreateCodeCruncher3Decoder(), "cc3", {"packed.bin"});
+    Benchmark(*CreateDataSquieezerDecoder(), "dsq", {"4kfixed.bin", "win512.bin", "win32768.bin"});
+    Benchmark(*CreateESVCruncherDecoder(), "esv", {"packed1.bin", "packed5.bin"});
+    Benchmark(*CreateHrumDecoder(), "hrum", {"packed1.bin", "packed2.bin"});
+    Benchmark(*CreateLZSDecoder(), "lzs", {"packed.bin"});
+    Benchmark(*CreateMegaLZDecoder(), "megalz", {"greedy.bin", "optimal.bin"});
+    Benchmark(*CreatePack2Decoder(), "pack2", {"packed.bin"});
+    Benchmark(*CreateTurboLZDecoder(), "tlz", {"packed1.bin"});
+    Benchmark(*CreateTRUSHDecoder(), "trush", {"packed.bin"});
+    Benchmark(*CreateZXZipDecoder(), "zxzip", {"none.bin", "normal.bin", "fast.bin"});
+  }
+  catch (const std::exception& e)
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+}
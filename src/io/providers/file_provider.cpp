@@ -91,6 +91,12 @@ namespace IO::File
       return Parameters::GetInteger<std::size_t>(Accessor, MMAP_THRESHOLD, MMAP_THRESHOLD_DEFAULT);
     }
 
+    uint_t MemoryMappingAdvice() const
+    {
+      using namespace Parameters::ZXTune::IO::Providers::File;
+      return Parameters::GetInteger<uint_t>(Accessor, MMAP_ADVICE, MMAP_ADVICE_DEFAULT);
+    }
+
     OverwriteMode Overwrite() const override
     {
       using namespace Parameters::ZXTune::IO::Providers::File;
@@ -187,9 +193,11 @@ namespace IO::File
   class MemoryMappedData : public Binary::Data
   {
   public:
-    explicit MemoryMappedData(const std::filesystem::path& path)
+    MemoryMappedData(const std::filesystem::path& path, uint_t advice)
     try : File(path.c_str(), boost::interprocess::read_only), Region(File, boost::interprocess::read_only)
-    {}
+    {
+      Advise(advice);
+    }
     catch (const boost::interprocess::interprocess_exception& e)
     {
       throw Error(THIS_LINE, e.what());
@@ -205,14 +213,30 @@ namespace IO::File
       return Region.get_size();
     }
 
+  private:
+    void Advise(uint_t advice)
+    {
+      using namespace Parameters::ZXTune::IO::Providers::File;
+      using boost::interprocess::mapped_region;
+      // hints are optional, so failures are just logged
+      if (advice == MMAP_ADVICE_SEQUENTIAL && !Region.advise(mapped_region::advice_sequential))
+      {
+        Dbg("Failed to apply sequential access hint");
+      }
+      else if (advice == MMAP_ADVICE_WILLNEED && !Region.advise(mapped_region::advice_willneed))
+      {
+        Dbg("Failed to apply willneed access hint");
+      }
+    }
+
   private:
     const boost::interprocess::file_mapping File;
-    const boost::interprocess::mapped_region Region;
+    boost::interprocess::mapped_region Region;
   };
 
-  Binary::Data::Ptr OpenMemoryMappedFile(const std::filesystem::path& path)
+  Binary::Data::Ptr OpenMemoryMappedFile(const std::filesystem::path& path, uint_t advice)
   {
-    return MakePtr<MemoryMappedData>(path);
+    return MakePtr<MemoryMappedData>(path, advice);
   }
 
   Binary::Data::Ptr ReadFileToMemory(std::ifstream& stream, std::size_t size)
@@ -277,7 +301,7 @@ namespace IO::File
     }
   }
 
-  Binary::Data::Ptr OpenData(StringView path, std::size_t mmapThreshold)
+  Binary::Data::Ptr OpenData(StringView path, std::size_t mmapThreshold, uint_t mmapAdvice)
   {
     const auto fileName = Details::FromString(path);
     const auto size = FileSize(fileName, THIS_LINE);
@@ -289,7 +313,7 @@ namespace IO::File
     {
       Dbg("Using memory-mapped i/o for '{}'.", path);
       // use local encoding here
-      return OpenMemoryMappedFile(fileName);
+      return OpenMemoryMappedFile(fileName, mmapAdvice);
     }
     else
     {
@@ -457,7 +481,8 @@ namespace IO::File
                                 Log::ProgressCallback& /*cb*/) const override
     {
       const ProviderParameters parameters(params);
-      return Binary::CreateContainer(OpenLocalFile(path, parameters.MemoryMappingThreshold()));
+      return Binary::CreateContainer(
+          OpenLocalFile(path, parameters.MemoryMappingThreshold(), parameters.MemoryMappingAdvice()));
     }
 
     Binary::OutputStream::Ptr Create(StringView path, const Parameters::Accessor& params,
@@ -471,11 +496,11 @@ namespace IO::File
 
 namespace IO
 {
-  Binary::Data::Ptr OpenLocalFile(StringView path, std::size_t mmapThreshold)
+  Binary::Data::Ptr OpenLocalFile(StringView path, std::size_t mmapThreshold, uint_t mmapAdvice)
   {
     try
     {
-      return File::OpenData(path, mmapThreshold);
+      return File::OpenData(path, mmapThreshold, mmapAdvice);
     }
     catch (const Error& e)
     {
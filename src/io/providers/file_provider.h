@@ -14,6 +14,7 @@
 #include "binary/output_stream.h"
 
 #include "string_view.h"
+#include "types.h"
 
 namespace Parameters
 {
@@ -22,7 +23,7 @@ namespace Parameters
 
 namespace IO
 {
-  Binary::Data::Ptr OpenLocalFile(StringView path, std::size_t mmapThreshold);
+  Binary::Data::Ptr OpenLocalFile(StringView path, std::size_t mmapThreshold, uint_t mmapAdvice = 0);
 
   enum class OverwriteMode
   {
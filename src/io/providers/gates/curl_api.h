@@ -34,6 +34,8 @@ namespace IO::Curl
     virtual CURLcode curl_easy_setopt(CURL *curl, CURLoption option, const char* strParam) = 0;
     virtual CURLcode curl_easy_setopt(CURL *curl, CURLoption option, void* opaqueParam) = 0;
     virtual CURLcode curl_easy_getinfo(CURL *curl, CURLINFO info, void* opaqueResult) = 0;
+    virtual struct curl_slist *curl_slist_append(struct curl_slist *list, const char *string) = 0;
+    virtual void curl_slist_free_all(struct curl_slist *list) = 0;
     // clang-format on
   };
 
@@ -118,6 +118,20 @@ namespace IO::Curl
       return func(curl, info, opaqueResult);
     }
 
+    struct curl_slist *curl_slist_append(struct curl_slist *list, const char *string) override
+    {
+      using FunctionType = decltype(&::curl_slist_append);
+      const auto func = Lib.GetSymbol<FunctionType>("curl_slist_append");
+      return func(list, string);
+    }
+
+    void curl_slist_free_all(struct curl_slist *list) override
+    {
+      using FunctionType = decltype(&::curl_slist_free_all);
+      const auto func = Lib.GetSymbol<FunctionType>("curl_slist_free_all");
+      return func(list);
+    }
+
     // clang-format on
   private:
     const Platform::SharedLibraryAdapter Lib;
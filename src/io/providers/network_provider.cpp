@@ -10,8 +10,10 @@
 
 #include "io/providers/network_provider.h"
 
+#include "io/impl/filesystem_path.h"
 #include "io/impl/l10n.h"
 #include "io/providers/enumerator.h"
+#include "io/providers/file_provider.h"
 #include "io/providers/gates/curl_api.h"
 
 #include "binary/container_factories.h"
@@ -19,6 +21,9 @@
 #include "debug/log.h"
 #include "io/providers_parameters.h"
 #include "parameters/accessor.h"
+#include "strings/casing.h"
+#include "strings/format.h"
+#include "strings/trim.h"
 #include "tools/progress_callback.h"
 
 #include "contract.h"
@@ -26,8 +31,15 @@
 #include "make_ptr.h"
 #include "string_view.h"
 
+#include <condition_variable>
 #include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <utility>
+#include <vector>
 
 namespace IO::Network
 {
@@ -45,6 +57,17 @@ namespace IO::Network
       return Parameters::GetString(Accessor, Parameters::ZXTune::IO::Providers::Network::Http::USERAGENT);
     }
 
+    String GetHttpCacheDirectory() const
+    {
+      return Parameters::GetString(Accessor, Parameters::ZXTune::IO::Providers::Network::Http::CACHE_DIRECTORY);
+    }
+
+    std::size_t MemoryMappingThreshold() const
+    {
+      using namespace Parameters::ZXTune::IO::Providers::File;
+      return Parameters::GetInteger<std::size_t>(Accessor, MMAP_THRESHOLD, MMAP_THRESHOLD_DEFAULT);
+    }
+
   private:
     const Parameters::Accessor& Accessor;
   };
@@ -63,6 +86,10 @@ namespace IO::Network
 
     ~CurlObject()
     {
+      if (Headers)
+      {
+        Api->curl_slist_free_all(Headers);
+      }
       if (Object)
       {
         Api->curl_easy_cleanup(Object);
@@ -87,6 +114,17 @@ namespace IO::Network
       CheckCurlResult(Api->curl_easy_getinfo(Object, info, param), loc);
     }
 
+    void AddHeader(const String& header, Error::LocationRef loc)
+    {
+      auto* const headers = Api->curl_slist_append(Headers, header.c_str());
+      Require(headers != nullptr);
+      if (!Headers)
+      {
+        Headers = headers;
+        SetOption<void*>(CURLOPT_HTTPHEADER, Headers, loc);
+      }
+    }
+
   private:
     void CheckCurlResult(CURLcode code, Error::LocationRef loc) const
     {
@@ -99,13 +137,92 @@ namespace IO::Network
   private:
     const Curl::Api::Ptr Api;
     CURL* Object;
+    curl_slist* Headers = nullptr;
   };
 
+  const long HTTP_PARTIAL_CONTENT = 206;
+  const long HTTP_NOT_MODIFIED = 304;
+
   bool IsHttpErrorCode(long code)
   {
     return 2 != (code / 100);
   }
 
+  // Values to check whether cached resource is still actual
+  struct Validators
+  {
+    String ETag;
+    String LastModified;
+
+    bool IsEmpty() const
+    {
+      return ETag.empty() && LastModified.empty();
+    }
+  };
+
+  struct ResponseHeaders
+  {
+    long Code = 0;
+    Validators Cache;
+
+    void Parse(StringView line)
+    {
+      static const auto STATUS = "HTTP/"sv;
+      static const auto ETAG = "ETag:"sv;
+      static const auto LAST_MODIFIED = "Last-Modified:"sv;
+      if (StartsWith(line, STATUS))
+      {
+        // new response after redirect
+        *this = ResponseHeaders();
+        const auto codePos = line.find(' ');
+        Code = codePos != line.npos ? std::atol(String{line.substr(codePos + 1, 3)}.c_str()) : 0;
+      }
+      else if (StartsWith(line, ETAG))
+      {
+        Cache.ETag = Strings::TrimSpaces(line.substr(ETAG.size()));
+      }
+      else if (StartsWith(line, LAST_MODIFIED))
+      {
+        Cache.LastModified = Strings::TrimSpaces(line.substr(LAST_MODIFIED.size()));
+      }
+    }
+
+  private:
+    static bool StartsWith(StringView line, StringView prefix)
+    {
+      return Strings::EqualNoCaseAscii(line.substr(0, prefix.size()), prefix);
+    }
+  };
+
+  class ResponseBody
+  {
+  public:
+    virtual ~ResponseBody() = default;
+
+    virtual void Add(Binary::View data) = 0;
+  };
+
+  class MemoryResponseBody : public ResponseBody
+  {
+  public:
+    MemoryResponseBody()
+      : Data(INITIAL_SIZE)
+    {}
+
+    void Add(Binary::View data) override
+    {
+      Data.Add(data);
+    }
+
+    Binary::Container::Ptr CaptureResult()
+    {
+      return Data.CaptureResult();
+    }
+
+  private:
+    Binary::DataBuilder Data;
+  };
+
   class RemoteResource
   {
   public:
@@ -115,6 +232,8 @@ namespace IO::Network
       Object.SetOption(CURLOPT_DEBUGFUNCTION, reinterpret_cast<void*>(&DebugCallback), THIS_LINE);
       Object.SetOption(CURLOPT_VERBOSE, 1, THIS_LINE);
       Object.SetOption(CURLOPT_WRITEFUNCTION, reinterpret_cast<void*>(&WriteCallback), THIS_LINE);
+      Object.SetOption(CURLOPT_HEADERFUNCTION, reinterpret_cast<void*>(&HeaderCallback), THIS_LINE);
+      Object.SetOption<void*>(CURLOPT_HEADERDATA, &Headers, THIS_LINE);
     }
 
     void SetSource(StringView url)
@@ -139,14 +258,36 @@ namespace IO::Network
       Object.SetOption(CURLOPT_NOPROGRESS, 0, THIS_LINE);
     }
 
+    //! @brief Request only modified resource
+    void SetValidators(const Validators& cached)
+    {
+      if (!cached.ETag.empty())
+      {
+        Object.AddHeader("If-None-Match: " + cached.ETag, THIS_LINE);
+      }
+      if (!cached.LastModified.empty())
+      {
+        Object.AddHeader("If-Modified-Since: " + cached.LastModified, THIS_LINE);
+      }
+    }
+
+    //! @brief Request the rest of resource starting from offset if it's not modified, whole resource otherwise
+    void SetRange(uint64_t offset, const Validators& partial)
+    {
+      Object.SetOption(CURLOPT_RANGE, Strings::Format("{}-", offset).c_str(), THIS_LINE);
+      Object.AddHeader("If-Range: " + (partial.ETag.empty() ? partial.LastModified : partial.ETag), THIS_LINE);
+    }
+
+    const ResponseHeaders& GetHeaders() const
+    {
+      return Headers;
+    }
+
     // TODO: pass callback to handle progress and other
     Binary::Container::Ptr Download()
     {
-      Binary::DataBuilder result(INITIAL_SIZE);
-      Object.SetOption<void*>(CURLOPT_WRITEDATA, &result, THIS_LINE);
-      Object.Perform(THIS_LINE);
-      long retCode = 0;
-      Object.GetInfo(CURLINFO_RESPONSE_CODE, &retCode, THIS_LINE);
+      MemoryResponseBody result;
+      const auto retCode = Download(result);
       if (IsHttpErrorCode(retCode))
       {
         throw MakeFormattedError(THIS_LINE, translate("Http error happends: {}."), retCode);
@@ -154,6 +295,16 @@ namespace IO::Network
       return result.CaptureResult();
     }
 
+    //! @return response code
+    long Download(ResponseBody& body)
+    {
+      Object.SetOption<void*>(CURLOPT_WRITEDATA, &body, THIS_LINE);
+      Object.Perform(THIS_LINE);
+      long retCode = 0;
+      Object.GetInfo(CURLINFO_RESPONSE_CODE, &retCode, THIS_LINE);
+      return retCode;
+    }
+
   private:
     static int DebugCallback(CURL* obj, curl_infotype type, char* data, size_t size, void* /*param*/)
     {
@@ -182,11 +333,26 @@ namespace IO::Network
       return 0;
     }
 
-    static size_t WriteCallback(const char* ptr, size_t size, size_t nmemb, Binary::DataBuilder* result)
+    static size_t WriteCallback(const char* ptr, size_t size, size_t nmemb, ResponseBody* result)
     {
       const std::size_t toSave = size * nmemb;
-      result->Add(Binary::View{ptr, toSave});
-      return toSave;
+      try
+      {
+        result->Add(Binary::View{ptr, toSave});
+        return toSave;
+      }
+      catch (const std::exception&)
+      {
+        // abort transfer
+        return 0;
+      }
+    }
+
+    static size_t HeaderCallback(const char* ptr, size_t size, size_t nmemb, ResponseHeaders* headers)
+    {
+      const std::size_t toParse = size * nmemb;
+      headers->Parse(Strings::TrimSpaces(StringView{ptr, toParse}));
+      return toParse;
     }
 
     static int ProgressCallback(void* data, double dlTotal, double dlNow, double /*ulTotal*/, double /*ulNow*/)
@@ -202,6 +368,254 @@ namespace IO::Network
 
   private:
     CurlObject Object;
+    ResponseHeaders Headers;
+  };
+
+  // Downloaded resource with its validators stored in separate file
+  class CachedFile
+  {
+  public:
+    CachedFile(std::filesystem::path data, StringView url)
+      : Url(url)
+      , DataPath(std::move(data))
+      , MetaPath(std::filesystem::path(DataPath) += ".meta")
+    {}
+
+    const std::filesystem::path& GetPath() const
+    {
+      return DataPath;
+    }
+
+    std::uintmax_t GetSize() const
+    {
+      std::error_code ec;
+      const auto size = std::filesystem::file_size(DataPath, ec);
+      return ec ? 0 : size;
+    }
+
+    std::optional<Validators> Load() const
+    {
+      std::ifstream meta(MetaPath);
+      String url;
+      Validators result;
+      if (std::getline(meta, url) && url == Url && std::getline(meta, result.ETag)
+          && std::getline(meta, result.LastModified) && GetSize() != 0)
+      {
+        return result;
+      }
+      return {};
+    }
+
+    void Store(const Validators& validators) const
+    {
+      std::ofstream meta(MetaPath, std::ios::trunc);
+      meta << Url << '\n' << validators.ETag << '\n' << validators.LastModified << '\n';
+      if (!meta.flush())
+      {
+        throw MakeFormattedError(THIS_LINE, translate("Failed to write file '{}'"), Details::ToString(MetaPath));
+      }
+    }
+
+    void MoveTo(const CachedFile& rh) const
+    {
+      std::error_code ec;
+      std::filesystem::rename(MetaPath, rh.MetaPath, ec);
+      if (!ec)
+      {
+        std::filesystem::rename(DataPath, rh.DataPath, ec);
+      }
+      if (ec)
+      {
+        throw MakeFormattedError(THIS_LINE, translate("Failed to rename file '{}': {}"), Details::ToString(DataPath),
+                                 ec.message());
+      }
+    }
+
+    void Remove() const
+    {
+      std::error_code ec;
+      std::filesystem::remove(MetaPath, ec);
+      std::filesystem::remove(DataPath, ec);
+    }
+
+  private:
+    const String Url;
+    const std::filesystem::path DataPath;
+    const std::filesystem::path MetaPath;
+  };
+
+  // Writes response to partial file, appending in case of partial content
+  class FileResponseBody : public ResponseBody
+  {
+  public:
+    FileResponseBody(const CachedFile& target, const ResponseHeaders& headers)
+      : Target(target)
+      , Headers(headers)
+    {}
+
+    void Add(Binary::View data) override
+    {
+      if (!Stream.is_open())
+      {
+        Open();
+      }
+      Written = true;
+      if (!Stream.write(data.As<char>(), data.Size()))
+      {
+        throw MakeFormattedError(THIS_LINE, translate("Failed to write file '{}'"),
+                                 Details::ToString(Target.GetPath()));
+      }
+    }
+
+    bool IsEmpty() const
+    {
+      return !Written;
+    }
+
+    void Close()
+    {
+      if (Stream.is_open())
+      {
+        Stream.close();
+      }
+    }
+
+  private:
+    void Open()
+    {
+      const auto append = Headers.Code == HTTP_PARTIAL_CONTENT;
+      if (!append)
+      {
+        Target.Store(Headers.Cache);
+      }
+      Stream.open(Target.GetPath(), std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+      if (!Stream)
+      {
+        throw Error(THIS_LINE, translate("Failed to open file."));
+      }
+    }
+
+  private:
+    const CachedFile& Target;
+    const ResponseHeaders& Headers;
+    std::ofstream Stream;
+    bool Written = false;
+  };
+
+  // Serializes access to the cached resources with the same url
+  class CacheEntryLock
+  {
+  public:
+    explicit CacheEntryLock(String id)
+      : Id(std::move(id))
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      Released.wait(lock, [this]() { return Active.count(Id) == 0; });
+      Active.insert(Id);
+    }
+
+    ~CacheEntryLock()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Active.erase(Id);
+      }
+      Released.notify_all();
+    }
+
+  private:
+    const String Id;
+    static std::mutex Guard;
+    static std::condition_variable Released;
+    static std::set<String> Active;
+  };
+
+  std::mutex CacheEntryLock::Guard;
+  std::condition_variable CacheEntryLock::Released;
+  std::set<String> CacheEntryLock::Active;
+
+  String GetCacheId(StringView url)
+  {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const auto sym : url)
+    {
+      hash = (hash ^ static_cast<uint8_t>(sym)) * 0x100000001b3ull;
+    }
+    return Strings::Format("{:016x}", hash);
+  }
+
+  class CachedResource
+  {
+  public:
+    CachedResource(const std::filesystem::path& dir, StringView url)
+      : Lock(GetCacheId(url))
+      , Complete(dir / Details::FromString(GetCacheId(url) + ".data"), url)
+      , Partial(dir / Details::FromString(GetCacheId(url) + ".part"), url)
+    {
+      std::error_code ec;
+      std::filesystem::create_directories(dir, ec);
+    }
+
+    //! @brief Setup request to download only missed or changed data
+    void Prepare(RemoteResource& resource) const
+    {
+      if (const auto complete = Complete.Load())
+      {
+        Dbg("Validate cached {}", Details::ToString(Complete.GetPath()));
+        resource.SetValidators(*complete);
+      }
+      else if (const auto partial = Partial.Load(); partial && !partial->IsEmpty())
+      {
+        const auto size = Partial.GetSize();
+        Dbg("Resume downloading {} from {}", Details::ToString(Partial.GetPath()), size);
+        resource.SetRange(size, *partial);
+      }
+    }
+
+    Binary::Container::Ptr Download(RemoteResource& resource, std::size_t mmapThreshold)
+    {
+      FileResponseBody body(Partial, resource.GetHeaders());
+      const auto code = resource.Download(body);
+      body.Close();
+      if (code == HTTP_NOT_MODIFIED)
+      {
+        Dbg("Not modified");
+        return Open(Complete.GetPath(), mmapThreshold);
+      }
+      else if (IsHttpErrorCode(code))
+      {
+        // possibly invalid range
+        Partial.Remove();
+        throw MakeFormattedError(THIS_LINE, translate("Http error happends: {}."), code);
+      }
+      else if (body.IsEmpty() && code != HTTP_PARTIAL_CONTENT)
+      {
+        Partial.Remove();
+        return Binary::CreateContainer(Binary::View(nullptr, 0));
+      }
+      else if (resource.GetHeaders().Cache.IsEmpty())
+      {
+        Dbg("Not cacheable");
+        auto result = Open(Partial.GetPath(), std::numeric_limits<std::size_t>::max());
+        Partial.Remove();
+        return result;
+      }
+      Dbg("Store to cache");
+      Partial.MoveTo(Complete);
+      return Open(Complete.GetPath(), mmapThreshold);
+    }
+
+  private:
+    static Binary::Container::Ptr Open(const std::filesystem::path& path, std::size_t mmapThreshold)
+    {
+      return Binary::CreateContainer(IO::OpenLocalFile(Details::ToString(path), mmapThreshold));
+    }
+
+  private:
+    const CacheEntryLock Lock;
+    const CachedFile Complete;
+    const CachedFile Partial;
   };
 
   // uri-related constants
@@ -217,6 +631,13 @@ namespace IO::Network
     return scheme == SCHEME_HTTP || scheme == SCHEME_HTTPS || scheme == SCHEME_FTP;
   }
 
+  auto IsCacheableUri(StringView uri)
+  {
+    const auto schemePos = uri.find(SCHEME_SIGN);
+    const auto scheme = uri.substr(0, schemePos);
+    return schemePos != uri.npos && (scheme == SCHEME_HTTP || scheme == SCHEME_HTTPS);
+  }
+
   class RemoteIdentifier : public Identifier
   {
   public:
@@ -342,7 +763,14 @@ namespace IO::Network
         resource.SetSource(path);
         resource.SetOptions(options);
         resource.SetProgressCallback(cb);
-        return resource.Download();
+        const auto cacheDir = options.GetHttpCacheDirectory();
+        if (cacheDir.empty() || !IsCacheableUri(path))
+        {
+          return resource.Download();
+        }
+        CachedResource cached(Details::FromString(cacheDir), path);
+        cached.Prepare(resource);
+        return cached.Download(resource, options.MemoryMappingThreshold());
       }
       catch (const Error& e)
       {
@@ -24,7 +24,7 @@ namespace Parameters::ZXTune::IO::Providers
     //! @brief Parameters#ZXTune#IO#Providers#File namespace prefix
     const auto PREFIX = Providers::PREFIX + "file"_id;
     //@{
-    //! @name Memory-mapping usage data size threshold parameter.
+    //! @name Memory-mapping usage data size threshold parameter. 0 to map all the files
 
     //! Default value
     const IntType MMAP_THRESHOLD_DEFAULT = 16384;
@@ -32,6 +32,21 @@ namespace Parameters::ZXTune::IO::Providers
     const auto MMAP_THRESHOLD = PREFIX + "mmap_threshold"_id;
     //@}
 
+    //@{
+    //! @name Access pattern hint for memory-mapped files
+
+    //! No hints
+    const IntType MMAP_ADVICE_NONE = 0;
+    //! Data is read mostly sequentially (e.g. raw scanning), aggressive read-ahead is expected
+    const IntType MMAP_ADVICE_SEQUENTIAL = 1;
+    //! Whole data is going to be accessed soon
+    const IntType MMAP_ADVICE_WILLNEED = 2;
+    //! Default value
+    const IntType MMAP_ADVICE_DEFAULT = MMAP_ADVICE_NONE;
+    //! Parameter full path
+    const auto MMAP_ADVICE = PREFIX + "mmap_advice"_id;
+    //@}
+
     //@{
     //! @name Create intermediate directories
 
@@ -76,6 +91,14 @@ namespace Parameters::ZXTune::IO::Providers
 
       //! Parameter full path
       const auto USERAGENT = PREFIX + "useragent"_id;
+      //@}
+
+      //@{
+      //! @name Directory to cache downloaded resources at. Empty to disable caching
+
+      //! Parameter full path
+      const auto CACHE_DIRECTORY = PREFIX + "cache_directory"_id;
+      //@}
     }  // namespace Http
   }    // namespace Network
 }  // namespace Parameters::ZXTune::IO::Providers
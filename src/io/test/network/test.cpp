@@ -0,0 +1,283 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Network provider cache test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "io/providers/providers_factories.h"
+
+#include "binary/container.h"
+#include "io/providers_parameters.h"
+#include "parameters/container.h"
+#include "strings/format.h"
+#include "tools/progress_callback.h"
+
+#include "error.h"
+
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+  void Test(bool res, const String& text, unsigned line)
+  {
+    std::cout << (res ? "Passed" : "Failed") << " test '" << text << "' at " << line << std::endl;
+    if (!res)
+    {
+      throw Error(line, "Test failed");
+    }
+  }
+
+#ifndef _WIN32
+  struct Resource
+  {
+    String Content;
+    String ETag;
+    // send only part of content and drop connection once
+    bool Drop = false;
+  };
+
+  // Minimal single-threaded http server supporting conditional and ranged requests
+  class Server
+  {
+  public:
+    Server()
+      : Socket(::socket(AF_INET, SOCK_STREAM, 0))
+    {
+      sockaddr_in addr = {};
+      addr.sin_family = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      socklen_t len = sizeof(addr);
+      if (Socket < 0 || ::bind(Socket, reinterpret_cast<sockaddr*>(&addr), len) != 0 || ::listen(Socket, 4) != 0
+          || ::getsockname(Socket, reinterpret_cast<sockaddr*>(&addr), &len) != 0)
+      {
+        throw Error(THIS_LINE, "Failed to start server");
+      }
+      Port = ntohs(addr.sin_port);
+      Worker = std::thread(&Server::WorkProc, this);
+    }
+
+    ~Server()
+    {
+      ::shutdown(Socket, SHUT_RDWR);
+      ::close(Socket);
+      Worker.join();
+    }
+
+    String GetUrl(StringView path) const
+    {
+      return Strings::Format("http://127.0.0.1:{}{}", Port, path);
+    }
+
+    void Set(const String& path, Resource res)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      Resources[path] = std::move(res);
+    }
+
+    int GetLastCode() const
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      return LastCode;
+    }
+
+  private:
+    void WorkProc()
+    {
+      for (;;)
+      {
+        const auto conn = ::accept(Socket, nullptr, nullptr);
+        if (conn < 0)
+        {
+          break;
+        }
+        Process(conn);
+        ::close(conn);
+      }
+    }
+
+    void Process(int conn)
+    {
+      String request;
+      char buf[1024];
+      while (request.find("\r\n\r\n") == request.npos)
+      {
+        const auto got = ::recv(conn, buf, sizeof(buf), 0);
+        if (got <= 0)
+        {
+          return;
+        }
+        request.append(buf, got);
+      }
+      const auto pathStart = request.find(' ') + 1;
+      const auto path = request.substr(pathStart, request.find(' ', pathStart) - pathStart);
+      const std::lock_guard<std::mutex> lock(Guard);
+      const auto it = Resources.find(path);
+      if (it == Resources.end())
+      {
+        Send(conn, 404, {}, {});
+        return;
+      }
+      auto& res = it->second;
+      const auto etagHeader = "\r\nETag: " + res.ETag;
+      if (!res.ETag.empty() && GetHeader(request, "If-None-Match") == res.ETag)
+      {
+        Send(conn, 304, etagHeader, {});
+      }
+      else if (const auto range = GetHeader(request, "Range");
+               !range.empty() && !res.ETag.empty() && GetHeader(request, "If-Range") == res.ETag)
+      {
+        const auto offset = std::stoul(range.substr(range.find('=') + 1));
+        const auto rangeHeader = Strings::Format("\r\nContent-Range: bytes {}-{}/{}", offset, res.Content.size() - 1,
+                                                 res.Content.size());
+        Send(conn, 206, etagHeader + rangeHeader, res.Content.substr(offset));
+      }
+      else
+      {
+        const auto headers = res.ETag.empty() ? String() : etagHeader;
+        if (res.Drop)
+        {
+          res.Drop = false;
+          const auto& body = res.Content;
+          SendHeaders(conn, 200, headers, body.size());
+          ::send(conn, body.data(), body.size() / 2, MSG_NOSIGNAL);
+        }
+        else
+        {
+          Send(conn, 200, headers, res.Content);
+        }
+      }
+    }
+
+    static String GetHeader(const String& request, const String& name)
+    {
+      const auto pos = request.find("\r\n" + name + ": ");
+      if (pos == request.npos)
+      {
+        return {};
+      }
+      const auto start = pos + name.size() + 4;
+      return request.substr(start, request.find("\r\n", start) - start);
+    }
+
+    void SendHeaders(int conn, int code, const String& headers, std::size_t size)
+    {
+      LastCode = code;
+      const auto response = Strings::Format("HTTP/1.1 {} Status{}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n",
+                                            code, headers, size);
+      ::send(conn, response.data(), response.size(), MSG_NOSIGNAL);
+    }
+
+    void Send(int conn, int code, const String& headers, const String& body)
+    {
+      SendHeaders(conn, code, headers, body.size());
+      ::send(conn, body.data(), body.size(), MSG_NOSIGNAL);
+    }
+
+  private:
+    const int Socket;
+    uint_t Port = 0;
+    mutable std::mutex Guard;
+    std::map<String, Resource> Resources;
+    int LastCode = 0;
+    std::thread Worker;
+  };
+
+  String MakeContent(std::size_t size, char base)
+  {
+    String result(size, 0);
+    for (std::size_t idx = 0; idx < size; ++idx)
+    {
+      result[idx] = static_cast<char>(base + idx % 23);
+    }
+    return result;
+  }
+
+  bool Open(const IO::DataProvider& provider, const String& url, const Parameters::Accessor& params,
+            const String& expected)
+  {
+    const auto data = provider.Open(url, params, Log::ProgressCallback::Stub());
+    const auto* const start = static_cast<const char*>(data->Start());
+    return data->Size() == expected.size() && 0 == expected.compare(0, expected.size(), start, data->Size());
+  }
+
+  bool IsFailedToOpen(const IO::DataProvider& provider, const String& url, const Parameters::Accessor& params)
+  {
+    try
+    {
+      provider.Open(url, params, Log::ProgressCallback::Stub());
+      return false;
+    }
+    catch (const Error&)
+    {
+      return true;
+    }
+  }
+
+  void TestCache(const IO::DataProvider& provider)
+  {
+    const auto cacheDir = std::filesystem::temp_directory_path() / "zxtune_io_test_network";
+    std::filesystem::remove_all(cacheDir);
+    const auto params = Parameters::Container::Create();
+    params->SetValue(Parameters::ZXTune::IO::Providers::Network::Http::CACHE_DIRECTORY, cacheDir.string());
+
+    Server server;
+    const auto url = server.GetUrl("/cached");
+    const auto content = MakeContent(100000, 'a');
+    server.Set("/cached", {content, "\"v1\""});
+    Test(Open(provider, url, *params, content) && server.GetLastCode() == 200, "Full download", __LINE__);
+    Test(Open(provider, url, *params, content) && server.GetLastCode() == 304, "Not modified", __LINE__);
+    const auto changed = MakeContent(50000, 'A');
+    server.Set("/cached", {changed, "\"v2\""});
+    Test(Open(provider, url, *params, changed) && server.GetLastCode() == 200, "Changed", __LINE__);
+
+    const auto resumeUrl = server.GetUrl("/resumed");
+    server.Set("/resumed", {content, "\"r1\"", true});
+    Test(IsFailedToOpen(provider, resumeUrl, *params), "Dropped connection", __LINE__);
+    Test(Open(provider, resumeUrl, *params, content) && server.GetLastCode() == 206, "Resumed", __LINE__);
+    Test(Open(provider, resumeUrl, *params, content) && server.GetLastCode() == 304, "Resumed not modified",
+         __LINE__);
+    server.Set("/resumed", {changed, "\"r2\"", true});
+    Test(IsFailedToOpen(provider, resumeUrl, *params), "Dropped connection on changed", __LINE__);
+    server.Set("/resumed", {content, "\"r3\""});
+    Test(Open(provider, resumeUrl, *params, content) && server.GetLastCode() == 200, "Changed while resuming",
+         __LINE__);
+
+    const auto plainUrl = server.GetUrl("/plain");
+    server.Set("/plain", {content, {}});
+    Test(Open(provider, plainUrl, *params, content) && server.GetLastCode() == 200, "Not cacheable", __LINE__);
+    Test(Open(provider, plainUrl, *params, content) && server.GetLastCode() == 200, "Not cacheable again", __LINE__);
+
+    std::filesystem::remove_all(cacheDir);
+  }
+#endif
+}  // namespace
+
+int main()
+{
+  try
+  {
+#ifndef _WIN32
+    TestCache(*IO::CreateNetworkDataProvider(IO::Curl::LoadDynamicApi()));
+#endif
+  }
+  catch (const Error& e)
+  {
+    std::cout << e.ToString();
+    return 1;
+  }
+}
@@ -10,9 +10,15 @@
 
 #include "io/providers/providers_factories.h"
 
+#include "binary/container.h"
+#include "io/providers_parameters.h"
+#include "parameters/container.h"
+#include "tools/progress_callback.h"
+
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 
 namespace
 {
@@ -306,6 +312,25 @@ namespace
     }
   }
 
+  void TestFileOpening()
+  {
+    std::cout << "Test for file opening" << std::endl;
+    using namespace Parameters::ZXTune::IO::Providers::File;
+    const IO::DataProvider::Ptr prov = IO::CreateFileDataProvider();
+    const auto params = Parameters::Container::Create();
+    params->SetValue(MMAP_THRESHOLD, std::numeric_limits<Parameters::IntType>::max());
+    const auto buffered = prov->Open("Makefile", *params, Log::ProgressCallback::Stub());
+    const std::string reference(static_cast<const char*>(buffered->Start()), buffered->Size());
+    params->SetValue(MMAP_THRESHOLD, 0);
+    for (const auto advice : {MMAP_ADVICE_NONE, MMAP_ADVICE_SEQUENTIAL, MMAP_ADVICE_WILLNEED})
+    {
+      params->SetValue(MMAP_ADVICE, advice);
+      const auto mapped = prov->Open("Makefile", *params, Log::ProgressCallback::Stub());
+      Test("mmap with advice " + std::to_string(advice),
+           std::string(static_cast<const char*>(mapped->Start()), mapped->Size()), reference);
+    }
+  }
+
   void TestNetworkProvider()
   {
     std::cout << "Test for network provider" << std::endl;
@@ -322,6 +347,7 @@ int main()
   try
   {
     TestFileProvider();
+    TestFileOpening();
     TestNetworkProvider();
   }
   catch (int code)
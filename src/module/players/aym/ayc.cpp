@@ -61,7 +61,7 @@ namespace Module::AYC
 
     AYM::StreamModel::Ptr CaptureResult() const
     {
-      return Data->IsEmpty() ? AYM::StreamModel::Ptr() : AYM::StreamModel::Ptr(Data);
+      return Data->IsEmpty() ? AYM::StreamModel::Ptr() : Data->CaptureResult();
     }
 
   private:
@@ -20,6 +20,7 @@
 
 #include "core/core_parameters.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "devices/beeper.h"
 #include "devices/z80.h"
 
@@ -32,6 +33,8 @@
 namespace Module::AYEMUL
 {
   const Debug::Stream Dbg("Core::AYSupp");
+  static auto& AYMRenderTime = Metrics::GetHistogram("devices.aym.render_ns");
+  static auto& BeeperRenderTime = Metrics::GetHistogram("devices.beeper.render_ns");
 
   class AyDataChannel
   {
@@ -90,6 +93,7 @@ namespace Module::AYEMUL
     Sound::Chunk RenderFrame(const Devices::AYM::Stamp& till)
     {
       AllocateChunk(till);
+      const Metrics::ScopedTimer timer(AYMRenderTime);
       Chip->RenderData(Chunks);
       Chunks.clear();
       return Chip->RenderTill(till);
@@ -156,6 +160,7 @@ namespace Module::AYEMUL
 
     Sound::Chunk RenderFrame(const Devices::AYM::Stamp& till)
     {
+      const Metrics::ScopedTimer timer(BeeperRenderTime);
       if (Chunks.empty())
       {
         Chip->RenderTill(till);
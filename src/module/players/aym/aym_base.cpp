@@ -14,6 +14,7 @@
 #include "module/players/tracking.h"
 
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "math/numeric.h"
 #include "sound/mixer_factory.h"
 
@@ -22,6 +23,7 @@
 namespace Module
 {
   const Debug::Stream Dbg("Core::AYBase");
+  static auto& RenderTime = Metrics::GetHistogram("devices.aym.render_ns");
 
   class AYMRenderer : public Renderer
   {
@@ -42,6 +44,7 @@ namespace Module
       TransferChunk();
       Iterator->NextFrame();
       LastChunk.TimeStamp += FrameDuration;
+      const Metrics::ScopedTimer timer(RenderTime);
       return Device->RenderTill(LastChunk.TimeStamp);
     }
 
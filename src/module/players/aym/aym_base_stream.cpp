@@ -12,12 +12,144 @@
 
 #include "module/players/streaming.h"
 
+#include "debug/log.h"
+
 #include "make_ptr.h"
 
 #include <utility>
 
 namespace Module::AYM
 {
+  const Debug::Stream Dbg("Module::AYMStream");
+
+  /*
+    Frame format:
+    uint16_t changes - mask of registers differ from previous frame, PRESENCE_CHANGED flag
+    uint16_t presence - mask of registers present in frame if PRESENCE_CHANGED
+    uint8_t values[] - for each changed and present register
+  */
+  const uint_t KEYFRAME_PERIOD = 256;
+  const uint_t PRESENCE_CHANGED = 0x8000;
+
+  static_assert(Devices::AYM::Registers::TOTAL < 15, "Too many registers to encode");
+
+  uint_t GetPresence(const Devices::AYM::Registers& regs)
+  {
+    uint_t res = 0;
+    for (Devices::AYM::Registers::IndicesIterator it(regs); it; ++it)
+    {
+      res |= 1 << *it;
+    }
+    return res;
+  }
+
+  void EncodeFrame(const Devices::AYM::Registers& prev, const Devices::AYM::Registers& cur, Binary::Dump& dst)
+  {
+    const auto prevPresence = GetPresence(prev);
+    const auto presence = GetPresence(cur);
+    uint_t changes = prevPresence ^ presence;
+    for (Devices::AYM::Registers::IndicesIterator it(cur); it; ++it)
+    {
+      if (prev[*it] != cur[*it])
+      {
+        changes |= 1 << *it;
+      }
+    }
+    if (prevPresence != presence)
+    {
+      changes |= PRESENCE_CHANGED;
+    }
+    dst.push_back(static_cast<uint8_t>(changes));
+    dst.push_back(static_cast<uint8_t>(changes >> 8));
+    if (changes & PRESENCE_CHANGED)
+    {
+      dst.push_back(static_cast<uint8_t>(presence));
+      dst.push_back(static_cast<uint8_t>(presence >> 8));
+    }
+    for (Devices::AYM::Registers::IndicesIterator it(cur); it; ++it)
+    {
+      if (changes & (1 << *it))
+      {
+        dst.push_back(cur[*it]);
+      }
+    }
+  }
+
+  const Devices::AYM::Registers& StreamModel::Reader::Get(uint_t pos)
+  {
+    Require(pos < Model.TotalFrames);
+    if (pos != Position)
+    {
+      if (pos < Position || pos / KEYFRAME_PERIOD != Position / KEYFRAME_PERIOD)
+      {
+        Position = pos - pos % KEYFRAME_PERIOD;
+        Offset = Model.KeyFrames[pos / KEYFRAME_PERIOD];
+        Current = {};
+        DecodeFrame();
+      }
+      while (Position < pos)
+      {
+        ++Position;
+        DecodeFrame();
+      }
+    }
+    return Current;
+  }
+
+  void StreamModel::Reader::DecodeFrame()
+  {
+    const auto* data = Model.Stream.data() + Offset;
+    const uint_t changes = data[0] | (uint_t(data[1]) << 8);
+    data += 2;
+    auto presence = GetPresence(Current);
+    if (changes & PRESENCE_CHANGED)
+    {
+      presence = data[0] | (uint_t(data[1]) << 8);
+      data += 2;
+    }
+    for (uint_t idx = 0; idx != Devices::AYM::Registers::TOTAL; ++idx)
+    {
+      const uint_t mask = 1 << idx;
+      if (changes & mask)
+      {
+        const auto reg = static_cast<Devices::AYM::Registers::Index>(idx);
+        if (presence & mask)
+        {
+          Current[reg] = *data++;
+        }
+        else
+        {
+          Current[reg] = 0;
+          Current.Reset(reg);
+        }
+      }
+    }
+    Offset = data - Model.Stream.data();
+  }
+
+  StreamModel::Ptr MutableStreamModel::CaptureResult() const
+  {
+    const auto totalFrames = static_cast<uint_t>(Data.size());
+    Binary::Dump stream;
+    std::vector<uint32_t> keyFrames;
+    keyFrames.reserve((totalFrames + KEYFRAME_PERIOD - 1) / KEYFRAME_PERIOD);
+    const Devices::AYM::Registers empty;
+    for (uint_t frame = 0; frame != totalFrames; ++frame)
+    {
+      const auto isKeyFrame = frame % KEYFRAME_PERIOD == 0;
+      if (isKeyFrame)
+      {
+        keyFrames.push_back(static_cast<uint32_t>(stream.size()));
+      }
+      EncodeFrame(isKeyFrame ? empty : Data[frame - 1], Data[frame], stream);
+    }
+    stream.shrink_to_fit();
+    auto result = MakePtr<StreamModel>(totalFrames, Loop, std::move(stream), std::move(keyFrames));
+    Dbg("Packed {} frames ({} bytes) into {} bytes", totalFrames, totalFrames * sizeof(Devices::AYM::Registers),
+        result->GetUsedMemory());
+    return result;
+  }
+
   class StreamDataIterator : public DataIterator
   {
   public:
@@ -25,6 +157,7 @@ namespace Module::AYM
       : Delegate(std::move(delegate))
       , State(Delegate->GetStateObserver())
       , Data(std::move(data))
+      , Frames(*Data)
     {}
 
     void Reset() override
@@ -44,13 +177,14 @@ namespace Module::AYM
 
     Devices::AYM::Registers GetData() const override
     {
-      return Data->Get(Delegate->CurrentFrame());
+      return Frames.Get(Delegate->CurrentFrame());
     }
 
   private:
     const StateIterator::Ptr Delegate;
     const Module::State::Ptr State;
     const StreamModel::Ptr Data;
+    mutable StreamModel::Reader Frames;
   };
 
   class StreamedChiptune : public Chiptune
@@ -13,18 +13,33 @@
 #include "module/players/aym/aym_chiptune.h"
 #include "module/players/stream_model.h"
 
+#include "binary/dump.h"
+
 #include "contract.h"
 
+#include <vector>
+
 namespace Module::AYM
 {
+  /*
+    Frames are stored as differences from the previous one. Each KEYFRAME_PERIOD frames differences chain is restarted
+    from the empty frame to provide random access.
+  */
   class StreamModel : public Module::StreamModel
   {
   public:
     using Ptr = std::shared_ptr<const StreamModel>;
 
+    StreamModel(uint_t totalFrames, uint_t loop, Binary::Dump stream, std::vector<uint32_t> keyFrames)
+      : TotalFrames(totalFrames)
+      , Loop(loop)
+      , Stream(std::move(stream))
+      , KeyFrames(std::move(keyFrames))
+    {}
+
     uint_t GetTotalFrames() const override
     {
-      return static_cast<uint_t>(Data.size());
+      return TotalFrames;
     }
 
     uint_t GetLoopFrame() const override
@@ -32,17 +47,44 @@ namespace Module::AYM
       return Loop;
     }
 
-    const Devices::AYM::Registers& Get(uint_t pos) const
+    std::size_t GetUsedMemory() const
     {
-      return Data[pos];
+      return Stream.size() + KeyFrames.size() * sizeof(KeyFrames.front());
     }
 
-  protected:
-    uint_t Loop = 0;
-    std::vector<Devices::AYM::Registers> Data;
+    Devices::AYM::Registers Get(uint_t pos) const
+    {
+      return Reader(*this).Get(pos);
+    }
+
+    //! Decodes frames incrementally, so sequential access is cheap
+    class Reader
+    {
+    public:
+      explicit Reader(const StreamModel& model)
+        : Model(model)
+      {}
+
+      const Devices::AYM::Registers& Get(uint_t pos);
+
+    private:
+      void DecodeFrame();
+
+    private:
+      const StreamModel& Model;
+      uint_t Position = ~uint_t(0);
+      std::size_t Offset = 0;
+      Devices::AYM::Registers Current;
+    };
+
+  private:
+    const uint_t TotalFrames;
+    const uint_t Loop;
+    const Binary::Dump Stream;
+    const std::vector<uint32_t> KeyFrames;
   };
 
-  class MutableStreamModel : public StreamModel
+  class MutableStreamModel
   {
   public:
     using Ptr = std::shared_ptr<MutableStreamModel>;
@@ -83,6 +125,12 @@ namespace Module::AYM
       Data.emplace_back();
       return Data.back();
     }
+
+    StreamModel::Ptr CaptureResult() const;
+
+  private:
+    uint_t Loop = 0;
+    std::vector<Devices::AYM::Registers> Data;
   };
 
   Chiptune::Ptr CreateStreamedChiptune(Time::Microseconds frameDuration, StreamModel::Ptr model,
@@ -44,7 +44,7 @@ namespace Module::PSG
 
     AYM::StreamModel::Ptr CaptureResult() const
     {
-      return Data->IsEmpty() ? AYM::StreamModel::Ptr() : AYM::StreamModel::Ptr(Data);
+      return Data->IsEmpty() ? AYM::StreamModel::Ptr() : Data->CaptureResult();
     }
 
   private:
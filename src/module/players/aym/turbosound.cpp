@@ -13,6 +13,7 @@
 #include "module/players/streaming.h"
 #include "parameters/src/names_set.h"
 
+#include "debug/metrics.h"
 #include "module/attributes.h"
 #include "parameters/merged_accessor.h"
 #include "parameters/visitor.h"
@@ -28,6 +29,8 @@
 
 namespace Module::TurboSound
 {
+  static auto& RenderTime = Metrics::GetHistogram("devices.aym.render_ns");
+
   class MergedModuleProperties : public Parameters::Accessor
   {
     static void MergeStringProperty(StringView /*propName*/, String& lh, StringView rh)
@@ -285,6 +288,7 @@ namespace Module::TurboSound
       TransferChunk();
       Iterator->NextFrame();
       LastChunk.TimeStamp += FrameDuration;
+      const Metrics::ScopedTimer timer(RenderTime);
       return Device->RenderTill(LastChunk.TimeStamp);
     }
 
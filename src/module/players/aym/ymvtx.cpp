@@ -132,7 +132,7 @@ namespace Module::YMVTX
 
     AYM::StreamModel::Ptr CaptureResult() const
     {
-      return Data->IsEmpty() ? AYM::StreamModel::Ptr() : AYM::StreamModel::Ptr(Data);
+      return Data->IsEmpty() ? AYM::StreamModel::Ptr() : Data->CaptureResult();
     }
 
     Time::Microseconds GetFrameDuration() const
@@ -10,12 +10,15 @@
 
 #include "module/players/dac/dac_base.h"
 
+#include "debug/metrics.h"
 #include "sound/multichannel_sample.h"
 
 #include "make_ptr.h"
 
 namespace Module
 {
+  static auto& RenderTime = Metrics::GetHistogram("devices.dac.render_ns");
+
   class DACDataIterator : public DAC::DataIterator
   {
   public:
@@ -84,6 +87,7 @@ namespace Module
       TransferChunk();
       Iterator->NextFrame();
       LastChunk.TimeStamp += FrameDuration;
+      const Metrics::ScopedTimer timer(RenderTime);
       return Device->RenderTill(LastChunk.TimeStamp);
     }
 
@@ -10,6 +10,7 @@
 
 #include "module/players/saa/saa_base.h"
 
+#include "debug/metrics.h"
 #include "math/numeric.h"
 
 #include "make_ptr.h"
@@ -18,6 +19,8 @@
 
 namespace Module
 {
+  static auto& RenderTime = Metrics::GetHistogram("devices.saa.render_ns");
+
   class SAADataIterator : public SAA::DataIterator
   {
   public:
@@ -86,6 +89,7 @@ namespace Module
       TransferChunk();
       Iterator->NextFrame();
       LastChunk.TimeStamp += FrameDuration;
+      const Metrics::ScopedTimer timer(RenderTime);
       return Device->RenderTill(LastChunk.TimeStamp);
     }
 
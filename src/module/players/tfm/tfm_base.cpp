@@ -10,12 +10,16 @@
 
 #include "module/players/tfm/tfm_base.h"
 
+#include "debug/metrics.h"
+
 #include "make_ptr.h"
 
 #include <utility>
 
 namespace Module
 {
+  static auto& RenderTime = Metrics::GetHistogram("devices.fm.render_ns");
+
   class TFMRenderer : public Renderer
   {
   public:
@@ -35,6 +39,7 @@ namespace Module
       TransferChunk();
       Iterator->NextFrame();
       LastChunk.TimeStamp += FrameDuration;
+      const Metrics::ScopedTimer timer(RenderTime);
       return Device->RenderTill(LastChunk.TimeStamp);
     }
 
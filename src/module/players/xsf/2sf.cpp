@@ -18,6 +18,7 @@
 
 #include "binary/compression/zlib_container.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "math/bitops.h"
 #include "module/attributes.h"
 #include "sound/resampler.h"
@@ -35,6 +36,8 @@ namespace Module::TwoSF
 {
   const Debug::Stream Dbg("Module::2SF");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.2sf.seek_ns");
+
   struct ModuleData
   {
     using Ptr = std::shared_ptr<const ModuleData>;
@@ -240,6 +243,7 @@ namespace Module::TwoSF
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine = MakePtr<DSEngine>(*Data);
@@ -17,6 +17,7 @@
 
 #include "binary/compression/zlib_container.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "module/attributes.h"
 
 #include "contract.h"
@@ -39,6 +40,8 @@ namespace Module::GSF
 {
   const Debug::Stream Dbg("Module::GSF");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.gsf.seek_ns");
+
   struct ModuleData
   {
     using Ptr = std::shared_ptr<const ModuleData>;
@@ -297,6 +300,7 @@ namespace Module::GSF
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine->Reset();
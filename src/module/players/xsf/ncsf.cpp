@@ -18,6 +18,7 @@
 
 #include "binary/compression/zlib_container.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "math/bitops.h"
 #include "module/attributes.h"
 #include "sound/resampler.h"
@@ -28,6 +29,7 @@
 #include "3rdparty/sseqplayer/Player.h"
 #include "3rdparty/sseqplayer/SDAT.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 
@@ -35,6 +37,8 @@ namespace Module::NCSF
 {
   const Debug::Stream Dbg("Module::NCSF");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.ncsf.seek_ns");
+
   struct ModuleData
   {
     using Ptr = std::shared_ptr<const ModuleData>;
@@ -109,10 +113,20 @@ namespace Module::NCSF
 
     void Skip(uint_t samples)
     {
-      // turn off interpolation during the fast-forward to speed up the emulation
+      // turn off interpolation and mixing during the fast-forward to speed up the emulation
+      const auto mutes = NCSFPlayer.mutes;
       NCSFPlayer.interpolation = INTERPOLATION_NONE;
-      SampleBuffer.resize(samples * 2 * sizeof(int16_t), 0);
-      NCSFPlayer.GenerateSamples(SampleBuffer, 0, samples);
+      NCSFPlayer.mutes.set();
+      // do not allocate buffer for the whole skipped period
+      const uint_t SKIP_CHUNK = 8192;
+      SampleBuffer.resize(std::min(samples, SKIP_CHUNK) * 2 * sizeof(int16_t), 0);
+      for (uint_t skipped = 0; skipped < samples;)
+      {
+        const auto toSkip = std::min(samples - skipped, SKIP_CHUNK);
+        NCSFPlayer.GenerateSamples(SampleBuffer, 0, toSkip);
+        skipped += toSkip;
+      }
+      NCSFPlayer.mutes = mutes;
       NCSFPlayer.interpolation = INTERPOLATION_SINC;
     }
 
@@ -197,6 +211,7 @@ namespace Module::NCSF
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine->Reset();
@@ -19,6 +19,7 @@
 
 #include "binary/compression/zlib_container.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "module/attributes.h"
 #include "sound/resampler.h"
 
@@ -38,6 +39,8 @@ namespace Module::PSF
 {
   const Debug::Stream Dbg("Module::PSF");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.psf.seek_ns");
+
   class VfsIO
   {
   public:
@@ -309,6 +312,7 @@ namespace Module::PSF
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine->Initialize(*Data);
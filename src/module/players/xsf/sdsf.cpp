@@ -16,6 +16,7 @@
 
 #include "binary/compression/zlib_container.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "module/attributes.h"
 #include "sound/resampler.h"
 
@@ -31,6 +32,8 @@ namespace Module::SDSF
 {
   const Debug::Stream Dbg("Module::SDSF");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.sdsf.seek_ns");
+
   struct ModuleData
   {
     using Ptr = std::shared_ptr<const ModuleData>;
@@ -212,6 +215,7 @@ namespace Module::SDSF
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine.Initialize(*Data);
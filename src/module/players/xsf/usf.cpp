@@ -15,6 +15,7 @@
 #include "module/players/xsf/xsf.h"
 
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "module/attributes.h"
 #include "sound/resampler.h"
 
@@ -30,6 +31,8 @@ namespace Module::USF
 {
   const Debug::Stream Dbg("Module::USF");
 
+  static auto& SeekTime = Metrics::GetHistogram("players.usf.seek_ns");
+
   struct ModuleData
   {
     using Ptr = std::shared_ptr<const ModuleData>;
@@ -204,6 +207,7 @@ namespace Module::USF
 
     void SetPosition(Time::AtMillisecond request) override
     {
+      const Metrics::ScopedTimer timer(SeekTime);
       if (request < State->At())
       {
         Engine.Reset();
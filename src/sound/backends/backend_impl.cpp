@@ -16,6 +16,7 @@
 
 #include "async/worker.h"
 #include "debug/log.h"
+#include "debug/metrics.h"
 #include "sound/render_params.h"
 #include "sound/sound_parameters.h"
 
@@ -29,6 +30,8 @@
 namespace Sound::BackendBase
 {
   const Debug::Stream Dbg("Sound::Backend::Base");
+  static auto& WriteTime = Metrics::GetHistogram("sound.backend.write_ns");
+  static auto& WrittenSamples = Metrics::GetCounter("sound.backend.samples");
 
   class CallbackOverWorker : public BackendCallback
   {
@@ -235,6 +238,8 @@ namespace Sound::BackendBase
         if (!data.empty())
         {
           Playing = true;
+          WrittenSamples.Add(data.size());
+          const Metrics::ScopedTimer timer(WriteTime);
           Worker->FrameFinish(std::move(data));
         }
         else
@@ -382,7 +387,7 @@ namespace Sound
     auto callback = BackendBase::CreateCallback(std::move(origCallback), worker);
     auto renderer = MakePtr<BackendBase::RendererWrapper>(std::move(origRenderer), callback);
     auto asyncWorker = MakePtr<BackendBase::AsyncWrapper>(std::move(callback), renderer, worker);
-    auto job = Async::CreateJob(std::move(asyncWorker));
+    auto job = Async::CreateJob(Async::Priority::REALTIME, std::move(asyncWorker));
     return MakePtr<BackendBase::BackendInternal>(std::move(worker), std::move(renderer), std::move(job));
   }
 }  // namespace Sound
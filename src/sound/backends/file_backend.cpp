@@ -24,11 +24,15 @@
 #include "sound/backends_parameters.h"
 #include "tools/progress_callback.h"
 
+#include "contract.h"
 #include "make_ptr.h"
 #include "string_view.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace Sound::File
 {
@@ -198,15 +202,20 @@ namespace Sound::File
     return nameTemplateWithRuntimeFields;
   }
 
+  // saving to multiple targets is always asynchronous to encode them in parallel
+  const uint_t MULTIPLE_TARGETS_MIN_BUFFERS = 2;
+
   class StreamSource
   {
   public:
-    StreamSource(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties, FileStreamFactory::Ptr factory)
+    StreamSource(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties, FileStreamFactory::Ptr factory,
+                 uint_t minBuffers)
       : Params(std::move(params))
       , Properties(std::move(properties))
       , Factory(std::move(factory))
       , FileParams(Params, Factory->GetId())
       , FilenameTemplate(InstantiateModuleFields(FileParams.GetFilenameTemplate(), *Properties))
+      , MinBuffers(minBuffers)
     {}
 
     Receiver::Ptr GetStream(const Module::State& state) const
@@ -218,7 +227,7 @@ namespace Sound::File
         Filename = newFilename;
         auto result = Factory->CreateStream(std::move(stream));
         SetProperties(*result);
-        if (const uint_t buffers = FileParams.GetBuffersCount())
+        if (const uint_t buffers = std::max(FileParams.GetBuffersCount(), MinBuffers))
         {
           return Async::DataReceiver<Chunk>::Create(1, buffers, std::move(result));
         }
@@ -258,6 +267,7 @@ namespace Sound::File
     const FileStreamFactory::Ptr Factory;
     const FileParameters FileParams;
     const TrackStateTemplate FilenameTemplate;
+    const uint_t MinBuffers;
     mutable String Filename;
   };
 
@@ -265,23 +275,29 @@ namespace Sound::File
   {
   public:
     BackendWorker(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties,
-                  FileStreamFactory::Ptr factory)
+                  std::vector<FileStreamFactory::Ptr> factories)
       : Params(std::move(params))
       , Properties(std::move(properties))
-      , Factory(std::move(factory))
-      , Stream(Receiver::CreateStub())
+      , Factories(std::move(factories))
     {}
 
     // BackendWorker
     void Startup() override
     {
-      Source = std::make_unique<StreamSource>(Params, Properties, Factory);
+      const auto minBuffers = Factories.size() > 1 ? MULTIPLE_TARGETS_MIN_BUFFERS : 0;
+      for (const auto& factory : Factories)
+      {
+        Targets.emplace_back(std::make_unique<StreamSource>(Params, Properties, factory, minBuffers));
+      }
     }
 
     void Shutdown() override
     {
-      SetStream(Receiver::CreateStub());
-      Source.reset();
+      for (auto& target : Targets)
+      {
+        target.SetStream(Receiver::CreateStub());
+      }
+      Targets.clear();
     }
 
     void Pause() override {}
@@ -290,16 +306,26 @@ namespace Sound::File
 
     void FrameStart(const Module::State& state) override
     {
-      if (const Receiver::Ptr newStream = Source->GetStream(state))
+      for (auto& target : Targets)
       {
-        SetStream(newStream);
+        if (auto newStream = target.Source->GetStream(state))
+        {
+          target.SetStream(std::move(newStream));
+        }
       }
     }
 
     void FrameFinish(Chunk buffer) override
     {
-      assert(Stream);
-      Stream->ApplyData(std::move(buffer));
+      assert(!Targets.empty());
+      // rendered once, copied for all the targets except the last one
+      for (auto it = Targets.begin(), last = std::prev(Targets.end()); it != last; ++it)
+      {
+        Chunk copy;
+        copy.assign(buffer.begin(), buffer.end());
+        it->Stream->ApplyData(std::move(copy));
+      }
+      Targets.back().Stream->ApplyData(std::move(buffer));
     }
 
     VolumeControl::Ptr GetVolumeControl() const override
@@ -309,26 +335,51 @@ namespace Sound::File
     }
 
   private:
-    void SetStream(Receiver::Ptr str)
+    struct Target
     {
-      Stream->Flush();
-      Stream = std::move(str);
-    }
+      explicit Target(std::unique_ptr<StreamSource> source)
+        : Source(std::move(source))
+        , Stream(Receiver::CreateStub())
+      {}
+
+      void SetStream(Receiver::Ptr str)
+      {
+        Stream->Flush();
+        Stream = std::move(str);
+      }
+
+      std::unique_ptr<StreamSource> Source;
+      Receiver::Ptr Stream;
+    };
 
   private:
     const Parameters::Accessor::Ptr Params;
     const Parameters::Accessor::Ptr Properties;
-    const FileStreamFactory::Ptr Factory;
-    std::unique_ptr<StreamSource> Source;
-    Receiver::Ptr Stream;
+    const std::vector<FileStreamFactory::Ptr> Factories;
+    std::vector<Target> Targets;
   };
 }  // namespace Sound::File
 
 namespace Sound
 {
+  BackendWorker::Ptr FileBackendWorkerFactory::CreateWorker(Parameters::Accessor::Ptr params,
+                                                            Module::Holder::Ptr holder) const
+  {
+    auto factory = CreateStreamFactory(params);
+    return CreateFileBackendWorker(std::move(params), holder->GetModuleProperties(), std::move(factory));
+  }
+
   BackendWorker::Ptr CreateFileBackendWorker(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties,
                                              FileStreamFactory::Ptr factory)
   {
-    return MakePtr<File::BackendWorker>(std::move(params), std::move(properties), std::move(factory));
+    std::vector<FileStreamFactory::Ptr> factories{std::move(factory)};
+    return CreateFileBackendWorker(std::move(params), std::move(properties), std::move(factories));
+  }
+
+  BackendWorker::Ptr CreateFileBackendWorker(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties,
+                                             std::vector<FileStreamFactory::Ptr> factories)
+  {
+    Require(!factories.empty());
+    return MakePtr<File::BackendWorker>(std::move(params), std::move(properties), std::move(factories));
   }
 }  // namespace Sound
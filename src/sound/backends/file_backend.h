@@ -15,6 +15,8 @@
 #include "binary/output_stream.h"
 #include "sound/receiver.h"
 
+#include <vector>
+
 namespace Sound
 {
   namespace File
@@ -45,6 +47,19 @@ namespace Sound
     virtual FileStream::Ptr CreateStream(Binary::OutputStream::Ptr stream) const = 0;
   };
 
+  //! @brief Base for file backends allowing to combine several targets in a single backend
+  class FileBackendWorkerFactory : public BackendWorkerFactory
+  {
+  public:
+    virtual FileStreamFactory::Ptr CreateStreamFactory(Parameters::Accessor::Ptr params) const = 0;
+
+    BackendWorker::Ptr CreateWorker(Parameters::Accessor::Ptr params, Module::Holder::Ptr holder) const override;
+  };
+
   BackendWorker::Ptr CreateFileBackendWorker(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties,
                                              FileStreamFactory::Ptr factory);
+
+  //! @brief Creates worker saving the same rendered data to all the targets, each one on its own thread
+  BackendWorker::Ptr CreateFileBackendWorker(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties,
+                                             std::vector<FileStreamFactory::Ptr> factories);
 }  // namespace Sound
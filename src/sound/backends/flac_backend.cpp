@@ -263,17 +263,16 @@ namespace Sound::Flac
     const Parameters::Accessor::Ptr Params;
   };
 
-  class BackendWorkerFactory : public Sound::BackendWorkerFactory
+  class BackendWorkerFactory : public FileBackendWorkerFactory
   {
   public:
     explicit BackendWorkerFactory(Api::Ptr api)
       : FlacApi(std::move(api))
     {}
 
-    BackendWorker::Ptr CreateWorker(Parameters::Accessor::Ptr params, Module::Holder::Ptr holder) const override
+    Sound::FileStreamFactory::Ptr CreateStreamFactory(Parameters::Accessor::Ptr params) const override
     {
-      auto factory = MakePtr<FileStreamFactory>(FlacApi, params);
-      return CreateFileBackendWorker(std::move(params), holder->GetModuleProperties(), std::move(factory));
+      return MakePtr<FileStreamFactory>(FlacApi, params);
     }
 
   private:
@@ -320,17 +320,16 @@ namespace Sound::Mp3
     const Parameters::Accessor::Ptr Params;
   };
 
-  class BackendWorkerFactory : public Sound::BackendWorkerFactory
+  class BackendWorkerFactory : public FileBackendWorkerFactory
   {
   public:
     explicit BackendWorkerFactory(Api::Ptr api)
       : LameApi(std::move(api))
     {}
 
-    BackendWorker::Ptr CreateWorker(Parameters::Accessor::Ptr params, Module::Holder::Ptr holder) const override
+    Sound::FileStreamFactory::Ptr CreateStreamFactory(Parameters::Accessor::Ptr params) const override
     {
-      auto factory = MakePtr<FileStreamFactory>(LameApi, params);
-      return CreateFileBackendWorker(std::move(params), holder->GetModuleProperties(), std::move(factory));
+      return MakePtr<FileStreamFactory>(LameApi, params);
     }
 
   private:
@@ -404,7 +404,7 @@ namespace Sound::Ogg
     const Parameters::Accessor::Ptr Params;
   };
 
-  class BackendWorkerFactory : public Sound::BackendWorkerFactory
+  class BackendWorkerFactory : public FileBackendWorkerFactory
   {
   public:
     BackendWorkerFactory(Api::Ptr oggApi, Vorbis::Api::Ptr vorbisApi, VorbisEnc::Api::Ptr vorbisEncApi)
@@ -413,10 +413,9 @@ namespace Sound::Ogg
       , VorbisEncApi(std::move(vorbisEncApi))
     {}
 
-    BackendWorker::Ptr CreateWorker(Parameters::Accessor::Ptr params, Module::Holder::Ptr holder) const override
+    Sound::FileStreamFactory::Ptr CreateStreamFactory(Parameters::Accessor::Ptr params) const override
     {
-      auto factory = MakePtr<FileStreamFactory>(OggApi, VorbisApi, VorbisEncApi, params);
-      return CreateFileBackendWorker(std::move(params), holder->GetModuleProperties(), std::move(factory));
+      return MakePtr<FileStreamFactory>(OggApi, VorbisApi, VorbisEncApi, params);
     }
 
   private:
@@ -12,6 +12,7 @@
 
 #include "sound/backends/backend_impl.h"
 #include "sound/backends/backends_list.h"
+#include "sound/backends/file_backend.h"
 #include "sound/backends/l10n.h"
 #include "sound/backends/storage.h"
 
@@ -116,6 +117,28 @@ namespace Sound
       }
     }
 
+    Backend::Ptr CreateBackend(std::span<const BackendId> ids, Module::Holder::Ptr module,
+                               BackendCallback::Ptr callback) const override
+    {
+      if (ids.size() == 1)
+      {
+        return CreateBackend(ids.front(), std::move(module), std::move(callback));
+      }
+      std::vector<FileStreamFactory::Ptr> factories;
+      for (const auto id : ids)
+      {
+        const auto factory = std::dynamic_pointer_cast<const FileBackendWorkerFactory>(FindFactory(id));
+        if (!factory)
+        {
+          throw MakeFormattedError(THIS_LINE, translate("Backend '{}' cannot be used for saving to multiple files."),
+                                   id);
+        }
+        factories.emplace_back(factory->CreateStreamFactory(Options));
+      }
+      auto worker = CreateFileBackendWorker(Options, module->GetModuleProperties(), std::move(factories));
+      return Sound::CreateBackend(Options, module, std::move(callback), std::move(worker));
+    }
+
     void Register(BackendId id, const char* description, uint_t caps, BackendWorkerFactory::Ptr factory) override
     {
       Factories.emplace_back(id, std::move(factory));
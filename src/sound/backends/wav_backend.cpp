@@ -249,13 +249,12 @@ namespace Sound::Wav
     const uint_t Frequency;
   };
 
-  class BackendWorkerFactory : public Sound::BackendWorkerFactory
+  class BackendWorkerFactory : public FileBackendWorkerFactory
   {
   public:
-    BackendWorker::Ptr CreateWorker(Parameters::Accessor::Ptr params, Module::Holder::Ptr holder) const override
+    Sound::FileStreamFactory::Ptr CreateStreamFactory(Parameters::Accessor::Ptr params) const override
     {
-      auto factory = MakePtr<FileStreamFactory>(GetSoundFrequency(*params));
-      return CreateFileBackendWorker(std::move(params), holder->GetModuleProperties(), std::move(factory));
+      return MakePtr<FileStreamFactory>(GetSoundFrequency(*params));
     }
   };
 }  // namespace Sound::Wav
@@ -18,13 +18,60 @@
 
 namespace Sound
 {
+  namespace ChunkPool
+  {
+    //! @brief Takes storage of at least specified size from the cache of released buffers or from heap
+    void* Allocate(std::size_t size);
+    //! @brief Puts storage taken via Allocate with the same size back to cache
+    void Release(void* ptr, std::size_t size) noexcept;
+  }  // namespace ChunkPool
+
+  //! @brief Allocator recycling buffers of sound chunks between frames.
+  //! Chunks are usually created by renderer and destroyed by consumer in steady rate, so steady-state playback does
+  //! not reach global heap at all.
+  template<class T>
+  struct ChunkAllocator
+  {
+    using value_type = T;
+
+    ChunkAllocator() = default;
+
+    template<class U>
+    ChunkAllocator(const ChunkAllocator<U>& /*rh*/) noexcept
+    {}
+
+    T* allocate(std::size_t count)
+    {
+      return static_cast<T*>(ChunkPool::Allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept
+    {
+      ChunkPool::Release(ptr, count * sizeof(T));
+    }
+
+    template<class U>
+    bool operator==(const ChunkAllocator<U>& /*rh*/) const noexcept
+    {
+      return true;
+    }
+
+    template<class U>
+    bool operator!=(const ChunkAllocator<U>& /*rh*/) const noexcept
+    {
+      return false;
+    }
+  };
+
   //! @brief Block of sound data
-  struct Chunk : public std::vector<Sample>
+  struct Chunk : public std::vector<Sample, ChunkAllocator<Sample>>
   {
+    using Storage = std::vector<Sample, ChunkAllocator<Sample>>;
+
     Chunk() = default;
 
     explicit Chunk(std::size_t size)
-      : std::vector<Sample>(size)
+      : Storage(size)
     {}
 
     Chunk(const Chunk&) = delete;
@@ -0,0 +1,130 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Sound chunks storage pool implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "sound/chunk.h"
+
+#include <array>
+#include <mutex>
+#include <new>
+
+namespace Sound::ChunkPool
+{
+  // buffers of 2^MIN_SIZE_BITS..2^MAX_SIZE_BITS bytes are recycled, up to 256kb (~1.5s of 44100Hz stereo)
+  const std::size_t MIN_SIZE_BITS = 10;
+  const std::size_t MAX_SIZE_BITS = 18;
+  const std::size_t CLASSES_COUNT = MAX_SIZE_BITS - MIN_SIZE_BITS + 1;
+  // enough for all the chunks in flight between renderer, resampler and backend
+  const std::size_t MAX_CACHED_PER_CLASS = 8;
+  // cache lives as long as process does
+  const std::size_t MAX_CACHED_SIZE = 2 << 20;
+
+  const std::size_t NO_CLASS = ~std::size_t(0);
+
+  std::size_t GetSizeClass(std::size_t size)
+  {
+    if (size > (std::size_t(1) << MAX_SIZE_BITS))
+    {
+      return NO_CLASS;
+    }
+    std::size_t bits = MIN_SIZE_BITS;
+    while ((std::size_t(1) << bits) < size)
+    {
+      ++bits;
+    }
+    return bits - MIN_SIZE_BITS;
+  }
+
+  std::size_t GetClassSize(std::size_t sizeClass)
+  {
+    return std::size_t(1) << (sizeClass + MIN_SIZE_BITS);
+  }
+
+  class Cache
+  {
+  public:
+    static Cache& Instance()
+    {
+      // intentionally never destroyed- chunks may be released from static objects destructors
+      static auto* const instance = new Cache();
+      return *instance;
+    }
+
+    void* Take(std::size_t sizeClass)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      auto& bucket = Buckets[sizeClass];
+      if (auto* node = bucket.Head)
+      {
+        bucket.Head = node->Next;
+        --bucket.Count;
+        TotalSize -= GetClassSize(sizeClass);
+        return node;
+      }
+      return nullptr;
+    }
+
+    bool Put(void* ptr, std::size_t sizeClass)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      auto& bucket = Buckets[sizeClass];
+      const auto size = GetClassSize(sizeClass);
+      if (bucket.Count == MAX_CACHED_PER_CLASS || TotalSize + size > MAX_CACHED_SIZE)
+      {
+        return false;
+      }
+      bucket.Head = new (ptr) Node{bucket.Head};
+      ++bucket.Count;
+      TotalSize += size;
+      return true;
+    }
+
+  private:
+    Cache() = default;
+
+  private:
+    struct Node
+    {
+      Node* Next;
+    };
+
+    struct Bucket
+    {
+      Node* Head = nullptr;
+      std::size_t Count = 0;
+    };
+
+    std::mutex Guard;
+    std::array<Bucket, CLASSES_COUNT> Buckets;
+    std::size_t TotalSize = 0;
+  };
+
+  void* Allocate(std::size_t size)
+  {
+    const auto sizeClass = GetSizeClass(size);
+    if (sizeClass == NO_CLASS)
+    {
+      return ::operator new(size);
+    }
+    if (auto* cached = Cache::Instance().Take(sizeClass))
+    {
+      return cached;
+    }
+    return ::operator new(GetClassSize(sizeClass));
+  }
+
+  void Release(void* ptr, std::size_t size) noexcept
+  {
+    const auto sizeClass = GetSizeClass(size);
+    if (sizeClass == NO_CLASS || !Cache::Instance().Put(ptr, sizeClass))
+    {
+      ::operator delete(ptr);
+    }
+  }
+}  // namespace Sound::ChunkPool
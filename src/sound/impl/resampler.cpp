@@ -10,6 +10,7 @@
 
 #include "sound/resampler.h"
 
+#include "debug/metrics.h"
 #include "tools/xrange.h"
 
 #include "contract.h"
@@ -22,6 +23,8 @@ extern "C"
 
 namespace Sound
 {
+  static auto& ResampleTime = Metrics::GetHistogram("sound.resample_ns");
+
   class CubicCore
   {
   public:
@@ -35,6 +38,7 @@ namespace Sound
 
     Chunk Apply(Chunk data)
     {
+      const Metrics::ScopedTimer timer(ResampleTime);
       Chunk result;
       result.reserve(data.size() * FreqOut / FreqIn + 1);
       const Sample* in = data.data();
@@ -101,6 +101,21 @@ namespace Sound
       In1 = in;
     }
 
+    //! @brief Feed the same sample several times
+    void Feed(const Sample in, uint_t count)
+    {
+      for (; count != 0; --count)
+      {
+        const bool stableInput = In1 == in && In2 == in && Out1 == Out2;
+        Feed(in);
+        if (stableInput && Out1 == Out2)
+        {
+          // fixed point is reached, further feeding does not change anything
+          break;
+        }
+      }
+    }
+
     Sample Get() const
     {
       return Out1;
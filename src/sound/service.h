@@ -37,6 +37,13 @@ namespace Sound
     //! @throw Error in case of error
     virtual Backend::Ptr CreateBackend(BackendId id, Module::Holder::Ptr module,
                                        BackendCallback::Ptr callback) const = 0;
+
+    //! @brief Create backend saving the same rendered data using several file backends simultaneously
+    //! @param ids File backends identifiers. Each one uses its own parameters (filename etc)
+    //! @return Result backend
+    //! @throw Error in case of error or if any of backends is not file one
+    virtual Backend::Ptr CreateBackend(std::span<const BackendId> ids, Module::Holder::Ptr module,
+                                       BackendCallback::Ptr callback) const = 0;
   };
 
   Service::Ptr CreateSystemService(Parameters::Accessor::Ptr options);
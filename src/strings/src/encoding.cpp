@@ -675,101 +675,155 @@ namespace Strings
   };
   // clang-format on
 
-  uint_t GetPenalty(const std::vector<uint32_t>& symbols)
+  // Accumulates heuristics of decoded text to estimate probability of proper codepage
+  class Statistics
   {
-    enum
+  public:
+    void Add(uint8_t traits, uint_t languages)
     {
-      PrevIsVowel = 1,
-      CurrIsVowel = 2,
-
-      ConsCons = 0,
-      VowCons = PrevIsVowel,
-      ConsVow = CurrIsVowel,
-      VowVow = PrevIsVowel + CurrIsVowel,
-
-      PairsTypes,
-    };
-    uint_t categories[CharTraits::CategoriesCount] = {0};
-    uint_t pairs[PairsTypes] = {0};  // 2*curIsVowel + 1*prevIsVowel;
-    uint_t languagesStrong = ~0;
-    uint_t languagesWeak = 0;
-    uint8_t prev = CharTraits::Undefined;
-    const auto& unicode = UnicodeTraits::Instance();
-    for (const auto sym : symbols)
-    {
-      const auto curr = unicode.GetTraits(sym);
-      if (!curr)
+      if (!traits)
       {
-        return std::numeric_limits<uint_t>::max();  // don't known how to recode
+        Undefined = true;
+        return;
       }
-      const auto cat = CharTraits::GetCategory(curr);
-      ++categories[cat];
-      const bool isAlphabetic = CharTraits::IsAlphabetic(curr);
-      if (CharTraits::IsAlphabetic(prev) && isAlphabetic)
+      ++Categories[CharTraits::GetCategory(traits)];
+      if (CharTraits::IsAlphabetic(traits))
       {
-        const bool prevIsVowel = prev & CharTraits::Vowel;
-        const bool currIsVowel = curr & CharTraits::Vowel;
-        ++pairs[CurrIsVowel * currIsVowel + PrevIsVowel * prevIsVowel];
+        if (CharTraits::IsAlphabetic(Prev))
+        {
+          const bool prevIsVowel = Prev & CharTraits::Vowel;
+          const bool currIsVowel = traits & CharTraits::Vowel;
+          // consonant-consonant and vowel-vowel
+          SamePairs += prevIsVowel == currIsVowel;
+        }
+        LanguagesStrong &= languages;
+        LanguagesWeak |= languages;
       }
-      if (isAlphabetic)
+      Prev = traits;
+    }
+
+    void Add(uint32_t sym)
+    {
+      const auto& unicode = UnicodeTraits::Instance();
+      Add(unicode.GetTraits(sym), unicode.GetLanguages(sym));
+    }
+
+    uint_t GetPenalty() const
+    {
+      if (Undefined)
       {
-        const auto langs = unicode.GetLanguages(sym);
-        languagesStrong &= langs;
-        languagesWeak |= langs;
+        return std::numeric_limits<uint_t>::max();  // don't known how to recode
       }
-      prev = curr;
+      const auto strongLangsCount = Math::CountBits(LanguagesStrong);
+      const auto weakLangsCount = Math::CountBits(LanguagesWeak);
+      const auto strongLangsPenalty = strongLangsCount > 1 ? strongLangsCount * 8 : (strongLangsCount == 1 ? 0 : 1024);
+      const auto weakLangsPenalty = weakLangsCount > 1 ? weakLangsCount * 4 : (weakLangsCount == 1 ? 0 : 2);
+      const auto ctrlPenalty = Categories[CharTraits::Control] * 512;
+      const auto graphPenalty = Categories[CharTraits::Graphic] * 256;
+      const auto punctPenalty = Categories[CharTraits::Punctuation] * 128;
+      const auto pairsPenalty = SamePairs * 64;
+      return ctrlPenalty + graphPenalty + punctPenalty + pairsPenalty + strongLangsPenalty + weakLangsPenalty;
     }
-    const auto strongLangsCount = Math::CountBits(languagesStrong);
-    const auto weakLangsCount = Math::CountBits(languagesWeak);
-    const auto strongLangsPenalty = strongLangsCount > 1 ? strongLangsCount * 8 : (strongLangsCount == 1 ? 0 : 1024);
-    const auto weakLangsPenalty = weakLangsCount > 1 ? weakLangsCount * 4 : (weakLangsCount == 1 ? 0 : 2);
-    const auto ctrlPenalty = categories[CharTraits::Control] * 512;
-    const auto graphPenalty = categories[CharTraits::Graphic] * 256;
-    const auto punctPenalty = categories[CharTraits::Punctuation] * 128;
-    const auto pairsPenalty = (pairs[ConsCons] + pairs[VowVow]) * 64;
-    return ctrlPenalty + graphPenalty + punctPenalty + pairsPenalty + strongLangsPenalty + weakLangsPenalty;
-  }
-
-  class Codepage
-  {
-  public:
-    virtual ~Codepage() = default;
 
-    virtual bool Check(StringView str) const = 0;
-    virtual std::vector<uint32_t> Translate(StringView str) const = 0;
+  private:
+    std::array<uint_t, CharTraits::CategoriesCount> Categories = {};
+    uint_t SamePairs = 0;
+    uint_t LanguagesStrong = ~0;
+    uint_t LanguagesWeak = 0;
+    uint8_t Prev = CharTraits::Undefined;
+    bool Undefined = false;
   };
 
-  template<class Traits>
-  class Codepage8Bit : public Codepage
+  // Single-byte codepages are classified simultaneously in one pass using precalculated per-byte tables
+  class Codepages8Bit
   {
   public:
-    bool Check(StringView) const override
+    static const std::size_t COUNT = 4;
+
+    using Decoder = uint32_t (*)(uint8_t);
+
+    // Returns index of the best codepage and its penalty
+    std::pair<std::size_t, uint_t> Classify(StringView str) const
     {
-      return true;
+      std::array<Statistics, COUNT> stats;
+      for (const uint8_t sym : str)
+      {
+        for (std::size_t idx = 0; idx != COUNT; ++idx)
+        {
+          const auto& cls = Classes[idx][sym];
+          stats[idx].Add(cls.Traits, cls.Languages);
+        }
+      }
+      std::size_t best = 0;
+      uint_t minPenalty = std::numeric_limits<uint_t>::max();
+      for (std::size_t idx = 0; idx != COUNT; ++idx)
+      {
+        const auto penalty = stats[idx].GetPenalty();
+        if (penalty <= minPenalty)
+        {
+          minPenalty = penalty;
+          best = idx;
+        }
+        if (0 == penalty)
+        {
+          break;
+        }
+      }
+      return {best, minPenalty};
     }
 
-    std::vector<uint32_t> Translate(StringView str) const override
+    String Translate(std::size_t idx, StringView str) const
     {
-      std::vector<uint32_t> result(str.size());
-      std::transform(str.begin(), str.end(), result.begin(), &Traits::GetUnicode);
-      return result;
+      const auto decoder = Decoders[idx];
+      Utf8Builder builder;
+      builder.Reserve(str.size());
+      for (const uint8_t sym : str)
+      {
+        builder.Add(decoder(sym));
+      }
+      return builder.GetResult();
     }
 
-    static const Codepage& Instance()
+    static const Codepages8Bit& Instance()
     {
-      static const Codepage8Bit<Traits> instance;
+      static const Codepages8Bit instance;
       return instance;
     }
 
   private:
-    Codepage8Bit() = default;
+    // in order of priority
+    Codepages8Bit()
+      : Decoders{&CP866::GetUnicode, &CP1251::GetUnicode, &CP1250::GetUnicode, &CP1252::GetUnicode}
+    {
+      const auto& unicode = UnicodeTraits::Instance();
+      for (std::size_t idx = 0; idx != COUNT; ++idx)
+      {
+        for (uint_t sym = 0; sym != 256; ++sym)
+        {
+          const auto code = Decoders[idx](sym);
+          auto& cls = Classes[idx][sym];
+          cls.Traits = unicode.GetTraits(code);
+          cls.Languages = unicode.GetLanguages(code);
+        }
+      }
+    }
+
+  private:
+    struct SymbolClass
+    {
+      uint8_t Traits;
+      uint16_t Languages;
+    };
+
+    const std::array<Decoder, COUNT> Decoders;
+    std::array<std::array<SymbolClass, 256>, COUNT> Classes;
   };
 
   // https://en.wikipedia.org/wiki/Shift_JIS
-  class ShiftJIS : public Codepage
+  class ShiftJIS
   {
   public:
-    bool Check(StringView str) const override
+    static bool Check(StringView str)
     {
       for (const auto* it = str.begin(); it != str.end(); ++it)
       {
@@ -803,47 +857,38 @@ namespace Strings
       return true;
     }
 
-    std::vector<uint32_t> Translate(StringView str) const override
+    // Should be called for checked strings only
+    template<class Target>
+    static void Translate(StringView str, Target& target)
     {
-      std::vector<uint32_t> result;
-      result.reserve(str.size());
       for (const auto* it = str.begin(); it != str.end(); ++it)
       {
         const uint8_t s1 = *it;
         if (s1 == 0x5c)
         {
-          result.push_back(0x00a5);
+          target.Add(0x00a5);
         }
         else if (s1 == 0x7e)
         {
-          result.push_back(0x203e);
+          target.Add(0x203e);
         }
         else if (s1 < 0x80)
         {
-          result.push_back(s1);
+          target.Add(s1);
         }
         else if (s1 > 0xa0 && s1 < 0xe0)
         {
-          result.push_back(0xff60 + (s1 - 0xa0));
+          target.Add(0xff60 + (s1 - 0xa0));
         }
         else
         {
           const uint8_t s2 = *++it;
-          result.push_back(GetUnicode(s1, s2));
+          target.Add(GetUnicode(s1, s2));
         }
       }
-      return result;
-    }
-
-    static const Codepage& Instance()
-    {
-      static const ShiftJIS instance;
-      return instance;
     }
 
   private:
-    ShiftJIS() = default;
-
     static uint32_t GetUnicode(uint_t s1, uint_t s2)
     {
 #include "strings/src/sjis2unicode.inc"
@@ -863,31 +908,21 @@ namespace Strings
 
   String Decode(StringView str)
   {
-    static const Codepage* CODEPAGES[] = {&Codepage8Bit<CP866>::Instance(), &Codepage8Bit<CP1251>::Instance(),
-                                          &Codepage8Bit<CP1250>::Instance(), &Codepage8Bit<CP1252>::Instance(),
-                                          &ShiftJIS::Instance()};
-
-    std::vector<uint32_t> bestUnicode;
-    uint_t minPenalty = std::numeric_limits<uint_t>::max();
-    for (const auto* const cp : CODEPAGES)
+    const auto& codepages = Codepages8Bit::Instance();
+    const auto [best, minPenalty] = codepages.Classify(str);
+    if (0 != minPenalty && ShiftJIS::Check(str))
     {
-      if (!cp->Check(str))
-      {
-        continue;
-      }
-      auto unicode = cp->Translate(str);
-      const auto penalty = GetPenalty(unicode);
-      if (penalty <= minPenalty)
-      {
-        minPenalty = penalty;
-        bestUnicode.swap(unicode);
-      }
-      if (0 == penalty)
+      Statistics stats;
+      ShiftJIS::Translate(str, stats);
+      if (stats.GetPenalty() <= minPenalty)
       {
-        break;
+        Utf8Builder builder;
+        builder.Reserve(str.size());
+        ShiftJIS::Translate(str, builder);
+        return builder.GetResult();
       }
     }
-    return Utf8Builder(bestUnicode.begin(), bestUnicode.end()).GetResult();
+    return codepages.Translate(best, str);
   }
 }  // namespace Strings
 
@@ -14,6 +14,8 @@
 #include "string_view.h"
 #include "types.h"
 
+#include <cstring>
+
 namespace Strings
 {
   class Utf8Builder
@@ -92,11 +94,33 @@ namespace Strings
     String Result;
   };
 
+  // Skips leading 7-bit symbols checking them by machine words
+  inline const char* SkipAscii(const char* it, const char* lim)
+  {
+    constexpr const uint64_t HIGH_BITS = 0x8080808080808080ull;
+    while (lim - it >= static_cast<std::ptrdiff_t>(sizeof(HIGH_BITS)))
+    {
+      uint64_t block = 0;
+      std::memcpy(&block, it, sizeof(block));
+      if (block & HIGH_BITS)
+      {
+        break;
+      }
+      it += sizeof(block);
+    }
+    return it;
+  }
+
   inline bool IsUtf8(StringView str)
   {
     // https://en.wikipedia.org/wiki/UTF-8#Description
     for (auto it = str.begin(), lim = str.end(); it != lim;)
     {
+      it = SkipAscii(it, lim);
+      if (it == lim)
+      {
+        break;
+      }
       //%0xxxxxx
       const uint_t sym = *it;
       ++it;
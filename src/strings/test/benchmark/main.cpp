@@ -0,0 +1,67 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Encoding detection throughput benchmark
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "strings/encoding.h"
+
+#include "string_view.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+  const auto TEST_DURATION = std::chrono::milliseconds(200);
+
+  // Returns processed kilostrings per second
+  double MeasureTranscoding(const std::vector<StringView>& strings)
+  {
+    using Clock = std::chrono::steady_clock;
+    std::size_t totalCount = 0;
+    std::size_t totalSize = 0;
+    const auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    do
+    {
+      for (const auto& str : strings)
+      {
+        totalSize += Strings::ToAutoUtf8(str).size();
+      }
+      totalCount += strings.size();
+      elapsed = Clock::now() - start;
+    } while (elapsed < TEST_DURATION);
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    return totalSize ? totalCount / seconds / 1000 : 0;
+  }
+
+  void Benchmark(StringView title, const std::vector<StringView>& strings)
+  {
+    std::cout << "  " << std::setw(16) << std::left << title << std::fixed << std::setprecision(2)
+              << MeasureTranscoding(strings) << " Kstr/s" << std::endl;
+  }
+}  // namespace
+
+int main()
+{
+  // typical titles, authors and comments met in modules
+  Benchmark("ASCII", {"Tech Kids", "Yerzmyey/H-Prg", "Sanchez (Crash'n'Die)", "Nq of Skrju",
+                      "Converted by X-Agent from original C64 tune. Greetz to all sceners!"});
+  Benchmark("UTF-8", {"\xd0\x9c\xd1\x83\xd0\xb7\xd1\x8b\xd0\xba\xd0\xb0 \xd0\xb4\xd0\xbb\xd1\x8f \xd0\xb8\xd0\xb3\xd1\x80\xd1\x8b",
+                      "S\xc3\xb8ren Lund", "\xe3\x81\xaf\xe3\x81\x98\xe3\x82\x81"});
+  Benchmark("CP866", {"\x8c\xe3\xa7\xeb\xaa\xa0 \xa4\xab\xef \xa8\xa3\xe0\xeb", "\xac\xe3\xa7\xeb\xaa\xa0",
+                      "\x8a\xae\xac\xaf\xae\xa7\xa8\xe2\xae\xe0: \x91\xa5\xe0\xa3\xa5\xa9 \x8a\xae\xe1\xe2\xa8\xad"});
+  Benchmark("CP1251", {"\xcc\xf3\xe7\xfb\xea\xe0 \xe4\xeb\xff \xe8\xe3\xf0\xfb", "\xe4\xe5\xe4\xf3\xf8\xea\xe0",
+                       "\xca\xee\xec\xef\xee\xe7\xe8\xf2\xee\xf0: \xd1\xe5\xf0\xe3\xe5\xe9 \xca\xee\xf1\xf2\xe8\xed"});
+  Benchmark("CP1250", {"Pi\xea\x9c\xe6 \xbfyczenia", "Mih\xe1ly Kov\xe1\x9a", "\x8a" "koda \xe8" "esk\xe1 hudba"});
+  Benchmark("CP1252", {"S\xf8ren", "H\xfclsbeck", "M\xf6ller - Norrg\xe5rd", "Skarzy\xf1zki"});
+  Benchmark("SJIS", {"\x83\x50\x83\x43\x83\x93\x82\xcc\x83\x65\x81\x5b\x83\x7d",
+                     "\x83\x58\x83\x65\x81\x5b\x83\x57 1"});
+}